@@ -44,15 +44,63 @@ class EccBencher {
         ->Arg(256)
         ->Arg(448);
 
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_MulFixedBase", prefix).c_str(),
+        [this](benchmark::State& st) { BenchMulFixedBase(st); })
+        ->Arg(256);
+    // Arg: window bits
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_CreateFixedBaseTable", prefix).c_str(),
+        [this](benchmark::State& st) { BenchCreateFixedBaseTable(st); })
+        ->Arg(4);
+
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_MultiScalarMul", prefix).c_str(),
+        [this](benchmark::State& st) { BenchMultiScalarMul(st); })
+        ->Arg(2)
+        ->Arg(16)
+        ->Arg(64)
+        ->Arg(256);
+
+    // Arg: 0 to check 256 points one by one, 1 to check them in a batch
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_IsInCurveGroup", prefix).c_str(),
+        [this](benchmark::State& st) { BenchIsInCurveGroup(st); })
+        ->DenseRange(0, 1);
+
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_GetAffinePoint", prefix).c_str(),
+        [this](benchmark::State& st) { BenchGetAffinePoint(st); });
     benchmark::RegisterBenchmark(
         fmt::format("{}/BM_HashPoint", prefix).c_str(),
         [this](benchmark::State& st) { BenchHashPoint(st); });
+    // Arg: 0 to hash/serialize 1024 points one by one, 1 in a batch
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_HashPoints", prefix).c_str(),
+        [this](benchmark::State& st) { BenchHashPoints(st); })
+        ->DenseRange(0, 1);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_SerializePoints", prefix).c_str(),
+        [this](benchmark::State& st) { BenchSerializePoints(st); })
+        ->DenseRange(0, 1);
+    // Arg: 0 for 256 points in std::vector<EcPoint>, 1 for EcPointArray
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_PointArrayMul", prefix).c_str(),
+        [this](benchmark::State& st) { BenchPointArrayMul(st); })
+        ->DenseRange(0, 1);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_PointArrayHash", prefix).c_str(),
+        [this](benchmark::State& st) { BenchPointArrayHash(st); })
+        ->DenseRange(0, 1);
     benchmark::RegisterBenchmark(
         fmt::format("{}/BM_PointEqual", prefix).c_str(),
         [this](benchmark::State& st) { BenchPointEqual(st); });
     benchmark::RegisterBenchmark(
         fmt::format("{}/BM_Add", prefix).c_str(),
         [this](benchmark::State& st) { BenchAdd(st); });
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_GetOrder", prefix).c_str(),
+        [this](benchmark::State& st) { BenchGetOrder(st); });
   }
 
   void BenchMulBase(benchmark::State& state) {
@@ -74,6 +122,68 @@ class EccBencher {
     }
   }
 
+  void BenchMulFixedBase(benchmark::State& state) {
+    MPInt p;
+    MPInt::RandomExactBits(256, &p);
+    auto table = ec_->CreateFixedBaseTable(ec_->MulBase(p));
+    MPInt s;
+    MPInt::RandomMonicExactBits(state.range(), &s);
+    for (auto _ : state) {
+      ec_->MulFixedBase(*table, s);
+    }
+  }
+
+  void BenchCreateFixedBaseTable(benchmark::State& state) {
+    MPInt p;
+    MPInt::RandomExactBits(256, &p);
+    auto point = ec_->MulBase(p);
+    for (auto _ : state) {
+      ec_->CreateFixedBaseTable(point, state.range());
+    }
+  }
+
+  void BenchMultiScalarMul(benchmark::State& state) {
+    std::vector<EcPoint> points;
+    std::vector<MPInt> scalars(state.range());
+    for (auto& s : scalars) {
+      MPInt::RandomExactBits(256, &s);
+      points.emplace_back(ec_->MulBase(s));
+      MPInt::RandomExactBits(256, &s);
+    }
+    for (auto _ : state) {
+      ec_->MultiScalarMul(points, scalars);
+    }
+  }
+
+  void BenchIsInCurveGroup(benchmark::State& state) {
+    // deserialized points, as in validation of untrusted input
+    std::vector<EcPoint> points;
+    for (size_t i = 0; i < 256; i++) {
+      MPInt s;
+      MPInt::RandomExactBits(256, &s);
+      points.emplace_back(
+          ec_->DeserializePoint(ec_->SerializePoint(ec_->MulBase(s))));
+    }
+    for (auto _ : state) {
+      if (state.range() == 0) {
+        for (const auto& p : points) {
+          ec_->IsInCurveGroup(p);
+        }
+      } else {
+        ec_->IsInCurveGroup(points);
+      }
+    }
+  }
+
+  void BenchGetAffinePoint(benchmark::State& state) {
+    MPInt p;
+    MPInt::RandomExactBits(256, &p);
+    auto point = ec_->MulBase(p);
+    for (auto _ : state) {
+      ec_->GetAffinePoint(point);
+    }
+  }
+
   void BenchHashPoint(benchmark::State& state) {
     MPInt p;
     MPInt::RandomExactBits(256, &p);
@@ -83,6 +193,77 @@ class EccBencher {
     }
   }
 
+  // sums of points, which are projective in most libs
+  std::vector<EcPoint> RandomPoints(size_t n) {
+    std::vector<EcPoint> points;
+    for (size_t i = 0; i < n; i++) {
+      MPInt s;
+      MPInt::RandomExactBits(256, &s);
+      points.emplace_back(ec_->Add(ec_->MulBase(s), ec_->GetGenerator()));
+    }
+    return points;
+  }
+
+  void BenchHashPoints(benchmark::State& state) {
+    auto points = RandomPoints(1024);
+    for (auto _ : state) {
+      if (state.range() == 0) {
+        for (const auto& p : points) {
+          ec_->HashPoint(p);
+        }
+      } else {
+        ec_->HashPoints(points);
+      }
+    }
+  }
+
+  void BenchSerializePoints(benchmark::State& state) {
+    auto points = RandomPoints(1024);
+    for (auto _ : state) {
+      if (state.range() == 0) {
+        for (const auto& p : points) {
+          ec_->SerializePoint(p);
+        }
+      } else {
+        ec_->SerializePoints(points);
+      }
+    }
+  }
+
+  void BenchPointArrayMul(benchmark::State& state) {
+    auto points = RandomPoints(256);
+    auto array = ec_->ToPointArray(points);
+    MPInt s;
+    MPInt::RandomExactBits(256, &s);
+    for (auto _ : state) {
+      if (state.range() == 0) {
+        std::vector<EcPoint> res;
+        res.reserve(points.size());
+        for (const auto& p : points) {
+          res.emplace_back(ec_->Mul(p, s));
+        }
+      } else {
+        ec_->BatchMul(array, s);
+      }
+    }
+  }
+
+  void BenchPointArrayHash(benchmark::State& state) {
+    auto points = RandomPoints(1024);
+    auto array = ec_->ToPointArray(points);
+    for (auto _ : state) {
+      if (state.range() == 0) {
+        for (const auto& p : points) {
+          benchmark::DoNotOptimize(ec_->HashPoint(p));
+        }
+      } else {
+        for (size_t i = 0; i < array.Size(); ++i) {
+          benchmark::DoNotOptimize(array.HashCode(i));
+        }
+      }
+    }
+  }
+
   void BenchPointEqual(benchmark::State& state) {
     MPInt s;
     MPInt::RandomExactBits(256, &s);
@@ -103,6 +284,12 @@ class EccBencher {
     }
   }
 
+  void BenchGetOrder(benchmark::State& state) {
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(ec_->GetOrder());
+    }
+  }
+
  private:
   std::unique_ptr<EcGroup> ec_;
 };
@@ -14,6 +14,9 @@
 
 #include "yacl/crypto/base/ecc/ec_point.h"
 
+#include <cstring>
+#include <string_view>
+
 namespace yacl::crypto {
 
 bool AffinePoint::operator==(const AffinePoint& rhs) const {
@@ -51,4 +54,45 @@ std::ostream& operator<<(std::ostream& os, const AffinePoint& point) {
   return os;
 }
 
+EcPointArray::EcPointArray(size_t size, size_t field_bytes)
+    : size_(size),
+      field_bytes_(field_bytes),
+      buf_(size * (1 + 2 * field_bytes), 0) {}
+
+std::size_t EcPointArray::HashCode(size_t idx) const {
+  auto slot = (*this)[idx];
+  if (slot[0] == 0) {
+    return 0;
+  }
+  // x and the parity of y determine the point
+  return std::hash<std::string_view>{}(
+             {reinterpret_cast<const char*>(slot.data() + 1),
+              field_bytes_}) +
+         (slot.back() & 1);
+}
+
+Buffer EcPointArray::Serialize(PointOctetFormat format) const {
+  bool compressed = format == PointOctetFormat::Autonomous ||
+                    format == PointOctetFormat::X962Compressed;
+  size_t width = compressed ? 1 + field_bytes_ : SlotBytes();
+
+  Buffer buf(size_ * width);
+  auto* out = buf.data<uint8_t>();
+  std::memset(out, 0, buf.size());
+  for (size_t i = 0; i < size_; ++i, out += width) {
+    auto slot = (*this)[i];
+    if (slot[0] == 0) {
+      continue;
+    }
+    std::memcpy(out, slot.data(), width);
+    uint8_t y_odd = slot.back() & 1;
+    if (compressed) {
+      out[0] = 0x02 | y_odd;
+    } else if (format == PointOctetFormat::X962Hybrid) {
+      out[0] = 0x06 | y_odd;
+    }
+  }
+  return buf;
+}
+
 }  // namespace yacl::crypto
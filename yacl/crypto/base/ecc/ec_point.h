@@ -16,6 +16,9 @@
 
 #include <utility>
 #include <variant>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "yacl/crypto/base/mpint/mp_int.h"
 
@@ -102,4 +105,49 @@ using Array64 = std::array<char, 64>;  // 512bits, store (x, y)
 using EcPoint =
     std::variant<Array32, Array33, Array64, AnyPointPtr, AffinePoint>;
 
+// Points stored back to back in fixed-width slots, so that a large set of
+// points needs neither a heap object nor a refcount per point.
+//
+// Each slot holds 0x04 || x || y, i.e. the X9.62 uncompressed form with x and
+// y padded to the field size, and the point at infinity is an all-zero slot.
+// The encoding is unique, so two slots hold the same point iff their bytes are
+// equal.
+//
+// Use EcGroup::ToPointArray() and EcGroup::GetPoint() to convert between
+// EcPoint and EcPointArray, and EcGroup::Batch*() to compute on arrays.
+class EcPointArray {
+ public:
+  EcPointArray() = default;
+  // All points are infinity
+  EcPointArray(size_t size, size_t field_bytes);
+
+  size_t Size() const { return size_; }
+  size_t FieldBytes() const { return field_bytes_; }
+  size_t SlotBytes() const { return 1 + 2 * field_bytes_; }
+
+  absl::Span<uint8_t> operator[](size_t idx) {
+    return {buf_.data() + idx * SlotBytes(), SlotBytes()};
+  }
+  absl::Span<const uint8_t> operator[](size_t idx) const {
+    return {buf_.data() + idx * SlotBytes(), SlotBytes()};
+  }
+
+  bool IsInfinity(size_t idx) const { return (*this)[idx][0] == 0; }
+
+  // Hash code of the idx'th point, for hash maps keyed on points of arrays.
+  // Note: it is not equal to EcGroup::HashPoint()
+  std::size_t HashCode(size_t idx) const;
+
+  // Concatenate the fixed-width encodings of all points. Finite points are
+  // encoded as in PointOctetFormat (Autonomous means X962Compressed), and the
+  // point at infinity takes a zero-filled slot of the same width, so the
+  // i'th point always starts at i * width.
+  Buffer Serialize(PointOctetFormat format) const;
+
+ private:
+  size_t size_ = 0;
+  size_t field_bytes_ = 0;
+  std::vector<uint8_t> buf_;
+};
+
 }  // namespace yacl::crypto
@@ -14,10 +14,14 @@
 
 #pragma once
 
+#include <memory>
 #include <ostream>
 #include <tuple>
 #include <utility>
 #include <variant>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "yacl/base/byte_container_view.h"
 #include "yacl/crypto/base/ecc/curve_meta.h"
@@ -89,6 +93,17 @@ enum class HashToCurveStrategy {
   HashToCurve,  // Not implemented, do not choose me
 };
 
+// Precomputed multiples of a point, see EcGroup::CreateFixedBaseTable().
+// The content is private to the lib which created the table.
+class FixedBaseTable {
+ public:
+  // Window size of the generic tables: ceil(k/4) point additions for a
+  // k-bit scalar, and 15 * ceil(k/4) points of memory
+  static constexpr size_t kDefaultWindowBits = 4;
+
+  virtual ~FixedBaseTable() = default;
+};
+
 // Base class of elliptic curve
 // Each subclass can implement one or more curve group.
 // Elliptic curves over finite field act as an abel group
@@ -106,19 +121,23 @@ class EcGroup {
   // Get the underlying elliptic curve lib name, e.g. openssl
   virtual std::string GetLibraryName() const = 0;
 
+  // The curve parameters below are computed when the group is created, and
+  // are returned by reference to avoid copies on hot paths. The references
+  // stay valid during the lifetime of this group instance.
+
   // The h, cofactor.
   // Cofactor is the number of non-overlapping subgroups of points, which
   // together hold all curve points
-  virtual MPInt GetCofactor() const = 0;
+  virtual const MPInt &GetCofactor() const = 0;
 
   // The field size of curve
   // returns the prime number (GFp) or the polynomial defining the underlying
   // field (GF2m)
-  virtual MPInt GetField() const = 0;
+  virtual const MPInt &GetField() const = 0;
 
   // The n, order of G, s.t. n < p
   // n is the order of the curve (the number of all its points)
-  virtual MPInt GetOrder() const = 0;
+  virtual const MPInt &GetOrder() const = 0;
 
   // The G, generator
   // Every elliptic curve defines a special pre-defined (constant) EC point
@@ -127,7 +146,9 @@ class EcGroup {
   // When G and n are carefully selected, and the cofactor = 1, all possible EC
   // points on the curve (including the special point infinity) can be generated
   // from the generator G by multiplying it by integer in the range [1...n].
-  virtual EcPoint GetGenerator() const = 0;
+  // Copies of G share the storage in some libs (e.g. openssl), so do not
+  // update a copy of G in place.
+  virtual const EcPoint &GetGenerator() const = 0;
 
   // Because the fastest known algorithm to solve the ECDLP for key of size k
   // needs sqrt(k) steps, this means that to achieve a k-bit security strength,
@@ -179,6 +200,31 @@ class EcGroup {
   // Returns: s1*G + s2*p2
   virtual EcPoint MulDoubleBase(const MPInt &s1, const MPInt &s2,
                                 const EcPoint &p2) const = 0;
+  // Multi-Scalar Multiplication
+  // Returns: s1*p1 + s2*p2 + ... + sn*pn
+  // Much faster than n independent multiplications followed by n-1 additions.
+  // @param points, scalars: must have the same size, scalars can be < 0
+  virtual EcPoint MultiScalarMul(absl::Span<const EcPoint> points,
+                                 absl::Span<const MPInt> scalars) const = 0;
+
+  // Fixed-Base multiplication for points other than G, e.g. the generators
+  // of Pedersen commitments or a peer's public key which is used many times.
+  // Build the table once, then each MulFixedBase() is much faster than Mul().
+  // Tables are immutable and hold no reference to this group instance, so
+  // they can be shared by threads and by group instances of the same curve
+  // and lib.
+  // @param point: must be in the prime-order subgroup
+  // @param window_bits: trades memory for speed, libs may ignore it
+  virtual std::shared_ptr<const FixedBaseTable> CreateFixedBaseTable(
+      const EcPoint &point, size_t window_bits) const = 0;
+  std::shared_ptr<const FixedBaseTable> CreateFixedBaseTable(
+      const EcPoint &point) const {
+    return CreateFixedBaseTable(point, FixedBaseTable::kDefaultWindowBits);
+  }
+  // Returns: point * scalar, where table = CreateFixedBaseTable(point)
+  // @param scalar: can be < 0
+  virtual EcPoint MulFixedBase(const FixedBaseTable &table,
+                               const MPInt &scalar) const = 0;
 
   // Output: p / s = p * s^-1
   // Please note that not all scalars have inverses
@@ -190,6 +236,27 @@ class EcGroup {
   virtual EcPoint Negate(const EcPoint &point) const = 0;
   virtual void NegateInplace(EcPoint *point) const = 0;
 
+  //================================//
+  //   Computation on point arrays  //
+  //================================//
+
+  // Bulk operations on EcPointArray, see ec_point.h for the array layout.
+  // Arrays must come from this group (same curve), the work is spread over
+  // all threads.
+
+  // Returns: res[i] = points[i]
+  virtual EcPointArray ToPointArray(absl::Span<const EcPoint> points) const = 0;
+  // Returns: array[idx]
+  virtual EcPoint GetPoint(const EcPointArray &array, size_t idx) const = 0;
+  // Returns: res[i] = scalars[i] * G
+  virtual EcPointArray BatchMulBase(absl::Span<const MPInt> scalars) const = 0;
+  // Returns: res[i] = points[i] * scalar, e.g. the masking step of ECDH-PSI
+  virtual EcPointArray BatchMul(const EcPointArray &points,
+                                const MPInt &scalar) const = 0;
+  // Returns: res[i] = p1[i] + p2[i]
+  virtual EcPointArray BatchAdd(const EcPointArray &p1,
+                                const EcPointArray &p2) const = 0;
+
   //================================//
   //     EcPoint helper tools       //
   //================================//
@@ -207,6 +274,15 @@ class EcGroup {
     SerializePoint(point, PointOctetFormat::Autonomous, buf);
   }
 
+  // Serialize many points. The result is the same as calling SerializePoint()
+  // one by one, but libs may share the projective-to-affine conversion, which
+  // costs one field inversion per point, over the whole batch.
+  virtual std::vector<Buffer> SerializePoints(
+      absl::Span<const EcPoint> points, PointOctetFormat format) const = 0;
+  std::vector<Buffer> SerializePoints(absl::Span<const EcPoint> points) const {
+    return SerializePoints(points, PointOctetFormat::Autonomous);
+  }
+
   // Load a point, the format MUST BE same with SerializePoint
   virtual EcPoint DeserializePoint(ByteContainerView buf,
                                    PointOctetFormat format) const = 0;
@@ -239,6 +315,17 @@ class EcGroup {
   // }
   // ```
   virtual std::size_t HashPoint(const EcPoint &point) const = 0;
+  // Batched HashPoint(), result[i] == HashPoint(points[i])
+  virtual std::vector<std::size_t> HashPoints(
+      absl::Span<const EcPoint> points) const = 0;
+
+  // Convert points to the cheapest representation for serializing and
+  // hashing, i.e. affine coordinates with Z = 1 for libs working in projective
+  // coordinates. The value of each point is not changed. Libs working in
+  // affine coordinates do nothing.
+  // Note: EcPoint copies share one underlying point, so do not call this on
+  // points which are being read by other threads.
+  virtual void BatchNormalize(absl::Span<EcPoint> points) const = 0;
 
   // Check p1 & p2 are equal
   // It is not recommended to directly compare the buffer of EcPoint using
@@ -250,6 +337,10 @@ class EcGroup {
   // Every override function in subclass must support EcPoint<AffinePoint>
   // representation.
   virtual bool IsInCurveGroup(const EcPoint &point) const = 0;
+  // Are all points in the prime-order subgroup of this curve. Libs amortize
+  // per-point costs over the batch, so prefer this one for validating many
+  // untrusted points, e.g. points of a deserialized proof.
+  virtual bool IsInCurveGroup(absl::Span<const EcPoint> points) const = 0;
 
   // Is the point at infinity
   virtual bool IsInfinity(const EcPoint &point) const = 0;
@@ -30,6 +30,7 @@ TEST(CurveFactoryTest, FactoryWorks) {
   ASSERT_TRUE(std::find(all.begin(), all.end(), "toy") != all.end())
       << fmt::format("{}", all);
   ASSERT_TRUE(std::find(all.begin(), all.end(), "openssl") != all.end());
+  ASSERT_TRUE(std::find(all.begin(), all.end(), "libsodium") != all.end());
 
   all = EcGroupFactory::ListEcLibraries("sm2");
   ASSERT_TRUE(std::find(all.begin(), all.end(), "toy") != all.end());
@@ -42,6 +43,12 @@ TEST(CurveFactoryTest, FactoryWorks) {
   // the openssl's performance is better, so the factory choose openssl
   auto c2 = EcGroupFactory::Create("sm2");
   EXPECT_STRCASEEQ(c2->GetLibraryName().c_str(), "openssl");
+
+  // curve25519 and ed25519 are served by libsodium first
+  auto c3 = EcGroupFactory::Create("curve25519");
+  EXPECT_STRCASEEQ(c3->GetLibraryName().c_str(), "libsodium");
+  auto c4 = EcGroupFactory::Create("ed25519");
+  EXPECT_STRCASEEQ(c4->GetLibraryName().c_str(), "libsodium");
 }
 
 // test
@@ -55,12 +62,21 @@ class EcCurveTest : public ::testing::TestWithParam<std::string> {
 
     TestArithmeticWorks();
     TestMulIsAdd();
+    TestMultiScalarMulWorks();
+    TestFixedBaseWorks();
     TestSerializeWorks();
     TestHashPointWorks();
+    TestBatchedHelpersWorks();
+    TestPointArrayWorks();
     TestStorePointsInMapWorks();
     MultiThreadWorks();
   }
 
+  bool SupportsX962() const {
+    return ec_->GetLibraryName() != "Toy" &&
+           ec_->GetLibraryName() != "libsodium";
+  }
+
   void TestArithmeticWorks() {
     EXPECT_STRCASEEQ(ec_->GetLibraryName().c_str(), GetParam().c_str());
 
@@ -73,6 +89,10 @@ class EcCurveTest : public ::testing::TestWithParam<std::string> {
     const auto p1 = ec_->MulBase(s);
     EXPECT_TRUE(ec_->IsInCurveGroup(p1));
     EXPECT_FALSE(ec_->IsInfinity(p1));
+    // batched check
+    std::vector<EcPoint> points = {p0, p1, ec_->MulBase(s + 1_mp)};
+    EXPECT_TRUE(ec_->IsInCurveGroup(points));
+    EXPECT_TRUE(ec_->IsInCurveGroup(absl::Span<const EcPoint>()));
 
     // Negate
     const auto p2 = ec_->MulBase(-s);
@@ -138,6 +158,59 @@ class EcCurveTest : public ::testing::TestWithParam<std::string> {
     }
   }
 
+  void TestMultiScalarMulWorks() {
+    for (size_t n : {0, 1, 3, 4, 17, 70, 300}) {
+      std::vector<EcPoint> points;
+      std::vector<MPInt> scalars;
+      auto expected = ec_->MulBase(0_mp);
+      for (size_t i = 0; i < n; ++i) {
+        // mix of big, small, zero and negative scalars
+        MPInt s;
+        MPInt::RandomExactBits(256, &s);
+        if (i % 3 == 1) {
+          s.NegateInplace();
+        } else if (i % 5 == 2) {
+          s = MPInt(i);
+        } else if (i % 7 == 5) {
+          s.SetZero();
+        }
+        // infinity point is allowed
+        points.emplace_back(ec_->MulBase(MPInt(i % 11 == 6 ? 0 : i * 37 + 1)));
+        scalars.emplace_back(s);
+        expected = ec_->Add(expected, ec_->Mul(points.back(), s));
+      }
+
+      auto res = ec_->MultiScalarMul(points, scalars);
+      ASSERT_TRUE(ec_->PointEqual(res, expected)) << fmt::format("n={}", n);
+    }
+
+    std::vector<EcPoint> points = {ec_->GetGenerator()};
+    EXPECT_ANY_THROW(ec_->MultiScalarMul(points, {}));
+  }
+
+  void TestFixedBaseWorks() {
+    auto p = ec_->MulBase(987654321_mp);
+    auto table = ec_->CreateFixedBaseTable(p);
+    auto table_w1 = ec_->CreateFixedBaseTable(p, 1);
+    auto order = ec_->GetOrder();
+    for (const auto &s : {0_mp, 1_mp, -1_mp, 15_mp, 16_mp, order - 1_mp, order,
+                          order + 5_mp, "123456789123456789123456789"_mp,
+                          -"123456789123456789123456789"_mp}) {
+      auto expected = ec_->Mul(p, s);
+      ASSERT_TRUE(ec_->PointEqual(ec_->MulFixedBase(*table, s), expected))
+          << s;
+      ASSERT_TRUE(ec_->PointEqual(ec_->MulFixedBase(*table_w1, s), expected))
+          << s;
+    }
+    // results are not aliases of the table
+    auto res = ec_->MulFixedBase(*table, 1_mp);
+    ec_->AddInplace(&res, p);
+    ASSERT_TRUE(ec_->PointEqual(ec_->MulFixedBase(*table, 1_mp), p));
+
+    auto inf_table = ec_->CreateFixedBaseTable(ec_->MulBase(0_mp));
+    ASSERT_TRUE(ec_->IsInfinity(ec_->MulFixedBase(*inf_table, 12345_mp)));
+  }
+
   void TestSerializeWorks() {
     auto s = 12345_mp;
     auto p1 = ec_->MulBase(s);  // p1 = sG
@@ -150,8 +223,8 @@ class EcCurveTest : public ::testing::TestWithParam<std::string> {
     ASSERT_TRUE(
         ec_->PointEqual(ec_->DeserializePoint(buf), ec_->GetGenerator()));
 
-    if (ec_->GetLibraryName() == "Toy") {
-      return;  // The toy lib do not support X9.62 format
+    if (!SupportsX962()) {
+      return;  // The toy and libsodium libs do not support X9.62 format
     }
 
     // test ANSI X9.62 format
@@ -213,6 +286,113 @@ class EcCurveTest : public ::testing::TestWithParam<std::string> {
     ASSERT_EQ(hit_table.size(), ts * 2);
   }
 
+  void TestBatchedHelpersWorks() {
+    // projective points (from Add) and infinity
+    std::vector<EcPoint> points;
+    auto p = ec_->MulBase(7_mp);
+    for (int i = 0; i < 20; ++i) {
+      points.emplace_back(i % 7 == 3 ? ec_->MulBase(0_mp) : p);
+      p = ec_->Add(p, ec_->GetGenerator());
+    }
+
+    std::vector<PointOctetFormat> formats = {PointOctetFormat::Autonomous};
+    if (SupportsX962()) {
+      formats.push_back(PointOctetFormat::X962Compressed);
+      formats.push_back(PointOctetFormat::X962Uncompressed);
+      formats.push_back(PointOctetFormat::X962Hybrid);
+    }
+    for (auto format : formats) {
+      auto bufs = ec_->SerializePoints(points, format);
+      ASSERT_EQ(bufs.size(), points.size());
+      for (size_t i = 0; i < points.size(); ++i) {
+        ASSERT_EQ(bufs[i], ec_->SerializePoint(points[i], format)) << i;
+      }
+    }
+
+    auto hashes = ec_->HashPoints(points);
+    ASSERT_EQ(hashes.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      ASSERT_EQ(hashes[i], ec_->HashPoint(points[i])) << i;
+    }
+
+    // normalize does not change the value
+    std::vector<EcPoint> normalized;
+    for (const auto &point : points) {
+      normalized.emplace_back(ec_->Add(point, ec_->MulBase(0_mp)));
+    }
+    ec_->BatchNormalize(absl::MakeSpan(normalized));
+    for (size_t i = 0; i < points.size(); ++i) {
+      ASSERT_TRUE(ec_->PointEqual(normalized[i], points[i])) << i;
+      ASSERT_EQ(ec_->HashPoint(normalized[i]), hashes[i]) << i;
+    }
+    EXPECT_TRUE(ec_->SerializePoints({}).empty());
+  }
+
+  void TestPointArrayWorks() {
+    // more than one block, with infinity and projective points
+    std::vector<EcPoint> points;
+    auto p = ec_->GetGenerator();
+    for (int i = 0; i < 600; ++i) {
+      points.emplace_back(i % 97 == 5 ? ec_->MulBase(0_mp) : p);
+      p = ec_->Add(p, ec_->GetGenerator());
+    }
+    auto array = ec_->ToPointArray(points);
+    ASSERT_EQ(array.Size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      ASSERT_EQ(array.IsInfinity(i), ec_->IsInfinity(points[i])) << i;
+      ASSERT_TRUE(ec_->PointEqual(ec_->GetPoint(array, i), points[i])) << i;
+    }
+    // equal points have equal slots
+    auto same = ec_->ToPointArray({ec_->Double(points[3]), points[5]});
+    auto doubled = ec_->ToPointArray({ec_->Add(points[3], points[3])});
+    EXPECT_TRUE(same[0] == doubled[0]);
+    EXPECT_EQ(same.HashCode(0), doubled.HashCode(0));
+    EXPECT_TRUE(same[1] == array[5]);
+
+    // bulk computation
+    constexpr size_t n = 20;
+    auto sub = ec_->ToPointArray(absl::MakeSpan(points).subspan(0, n));
+    std::vector<MPInt> scalars;
+    for (size_t i = 0; i < n; ++i) {
+      scalars.emplace_back(MPInt(i * 7919 + (i == 3 ? 0 : 1)));
+    }
+    auto s = 123456789_mp;
+    auto mul_base = ec_->BatchMulBase(scalars);
+    auto mul = ec_->BatchMul(sub, s);
+    auto add = ec_->BatchAdd(sub, mul_base);
+    for (size_t i = 0; i < n; ++i) {
+      auto expected = ec_->MulBase(scalars[i]);
+      ASSERT_TRUE(ec_->PointEqual(ec_->GetPoint(mul_base, i), expected)) << i;
+      ASSERT_TRUE(ec_->PointEqual(ec_->GetPoint(mul, i),
+                                  ec_->Mul(points[i], s)))
+          << i;
+      ASSERT_TRUE(ec_->PointEqual(ec_->GetPoint(add, i),
+                                  ec_->Add(points[i], expected)))
+          << i;
+    }
+    EXPECT_ANY_THROW(ec_->BatchAdd(sub, array));
+    EXPECT_EQ(ec_->BatchMul(EcPointArray(0, array.FieldBytes()), s).Size(), 0);
+
+    if (!SupportsX962()) {
+      return;  // The toy and libsodium libs do not support X9.62 format
+    }
+    for (auto format :
+         {PointOctetFormat::X962Compressed, PointOctetFormat::X962Uncompressed,
+          PointOctetFormat::X962Hybrid}) {
+      auto buf = sub.Serialize(format);
+      ASSERT_EQ(buf.size() % n, 0);
+      size_t width = buf.size() / n;
+      for (size_t i = 0; i < n; ++i) {
+        if (sub.IsInfinity(i)) {
+          continue;
+        }
+        ASSERT_EQ(ByteContainerView(buf.data<uint8_t>() + i * width, width),
+                  ByteContainerView(ec_->SerializePoint(points[i], format)))
+            << i;
+      }
+    }
+  }
+
   void TestStorePointsInMapWorks() {
     auto hash = [&](const EcPoint &p) { return ec_->HashPoint(p); };
     auto equal = [&](const EcPoint &p1, const EcPoint &p2) {
@@ -283,4 +463,26 @@ TEST_P(Sm2CurveTest, SpiTest) {
   RunAllTests();
 }
 
+class Ed25519CurveTest : public EcCurveTest {
+ protected:
+  void SetUp() override {
+    ec_ = EcGroupFactory::Create("ed25519", GetParam());
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    Ed25519Test, Ed25519CurveTest,
+    ::testing::ValuesIn(EcGroupFactory::ListEcLibraries("ed25519")));
+
+TEST_P(Ed25519CurveTest, SpiTest) {
+  EXPECT_STRCASEEQ(ec_->GetCurveName().c_str(), "ed25519");
+  EXPECT_EQ(ec_->GetCurveForm(), CurveForm::TwistedEdwards);
+  EXPECT_EQ(ec_->GetFieldType(), FieldType::Prime);
+  EXPECT_EQ(ec_->GetSecurityStrength(), 127);
+  EXPECT_FALSE(ec_->ToString().empty());
+
+  // Run Other tests
+  RunAllTests();
+}
+
 }  // namespace yacl::crypto::test
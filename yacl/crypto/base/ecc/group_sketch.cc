@@ -14,8 +14,76 @@
 
 #include "yacl/crypto/base/ecc/group_sketch.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "yacl/utils/parallel.h"
+
 namespace yacl::crypto {
 
+namespace {
+
+// Below this size, the bucket method has no advantage over plain double-and-add
+constexpr size_t kPippengerThreshold = 4;
+
+// Pick the bucket window size c which minimizes the estimated number of point
+// additions: (bits / c) * (n + 2^(c+1))
+size_t PippengerWindowSize(size_t n) {
+  size_t best_c = 2;
+  double best_cost = (n + (1 << 3)) / 2.0;
+  for (size_t c = 3; c <= 16; ++c) {
+    double cost = (n + (1 << (c + 1))) / static_cast<double>(c);
+    if (cost < best_cost) {
+      best_c = c;
+      best_cost = cost;
+    }
+  }
+  return best_c;
+}
+
+// Get bits [offset, offset + c) of a little-endian magnitude buffer
+size_t GetWindow(const uint8_t *buf, size_t buf_len, size_t offset, size_t c) {
+  size_t res = 0;
+  for (size_t i = 0; i < c; ++i) {
+    size_t bit = offset + i;
+    if (bit / 8 >= buf_len) {
+      break;
+    }
+    res |= static_cast<size_t>((buf[bit / 8] >> (bit % 8)) & 1) << i;
+  }
+  return res;
+}
+
+// Windowed table of a point P: points[i * (2^w - 1) + d - 1] = d * 2^(w*i) * P,
+// so a multiplication by a k-bit scalar costs ceil(k/w) additions and no
+// doubling
+struct WindowedTable final : public FixedBaseTable {
+  CurveName curve;
+  size_t window_bits;
+  size_t num_windows;
+  std::vector<EcPoint> points;
+};
+
+// EcPointArray ops work in blocks, so each thread keeps at most one block of
+// EcPoint objects alive
+constexpr int64_t kPointArrayBlock = 256;
+
+// Call f(beg, end, scratch) on blocks of [0, n) in parallel, scratch is
+// reused by the blocks of one thread
+template <typename F>
+void ForEachBlock(size_t n, const F &f) {
+  yacl::parallel_for(0, n, kPointArrayBlock, [&](int64_t beg, int64_t end) {
+    std::vector<EcPoint> scratch;
+    for (int64_t i = beg; i < end; i += kPointArrayBlock) {
+      f(i, std::min(end, i + kPointArrayBlock), &scratch);
+    }
+  });
+}
+
+}  // namespace
+
 void EcGroupSketch::AddInplace(EcPoint *p1, const EcPoint &p2) const {
   *p1 = Add(*p1, p2);
 }
@@ -45,6 +113,182 @@ EcPoint EcGroupSketch::MulDoubleBase(const MPInt &s1, const MPInt &s2,
   return Add(MulBase(s1), Mul(p2, s2));
 }
 
+EcPoint EcGroupSketch::MultiScalarMul(absl::Span<const EcPoint> points,
+                                      absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(points.size() == scalars.size(),
+               "MultiScalarMul: size mismatch, #points={}, #scalars={}",
+               points.size(), scalars.size());
+
+  if (points.size() < kPippengerThreshold) {
+    EcPoint res = MulBase(0_mp);
+    for (size_t i = 0; i < points.size(); ++i) {
+      AddInplace(&res, Mul(points[i], scalars[i]));
+    }
+    return res;
+  }
+
+  // Pippenger's bucket method. Negative scalars are handled by negating the
+  // corresponding point, so that we only deal with magnitudes below.
+  size_t n = points.size();
+  std::vector<EcPoint> pts;
+  pts.reserve(n);
+  size_t max_bits = 0;
+  for (size_t i = 0; i < n; ++i) {
+    pts.emplace_back(scalars[i].IsNegative() ? Negate(points[i]) : points[i]);
+    max_bits = std::max(max_bits, scalars[i].BitCount());
+  }
+
+  size_t byte_len = (max_bits + 7) / 8;
+  std::vector<uint8_t> mags(n * byte_len);
+  for (size_t i = 0; i < n; ++i) {
+    scalars[i].Abs().ToBytes(mags.data() + i * byte_len, byte_len,
+                             Endian::little);
+  }
+
+  size_t c = PippengerWindowSize(n);
+  size_t num_windows = (max_bits + c - 1) / c;
+  size_t num_buckets = (static_cast<size_t>(1) << c) - 1;
+
+  // Creating identity points is not free, so every accumulator below starts
+  // empty and tracks its state: 0 -> empty, 1 -> aliases an input point (read
+  // only), 2 -> owns a freshly computed point (can be updated in place).
+  // Note that an accumulator is only aliased while its source is in state 1,
+  // so in-place updates never leak into other accumulators.
+  auto accumulate = [this](EcPoint *acc, uint8_t *st, const EcPoint &p) {
+    switch (*st) {
+      case 0:
+        *acc = p;
+        *st = 1;
+        break;
+      case 1:
+        *acc = Add(*acc, p);
+        *st = 2;
+        break;
+      default:
+        AddInplace(acc, p);
+    }
+  };
+
+  std::vector<EcPoint> buckets(num_buckets);
+  std::vector<uint8_t> bucket_st(num_buckets);
+  EcPoint res;
+  uint8_t res_st = 0;
+  for (size_t w = num_windows; w-- > 0;) {
+    for (size_t i = 0; i < c && res_st != 0; ++i) {
+      if (res_st == 1) {
+        res = Double(res);
+        res_st = 2;
+      } else {
+        DoubleInplace(&res);
+      }
+    }
+
+    std::fill(bucket_st.begin(), bucket_st.end(), 0);
+    for (size_t i = 0; i < n; ++i) {
+      size_t d = GetWindow(mags.data() + i * byte_len, byte_len, w * c, c);
+      if (d != 0) {
+        accumulate(&buckets[d - 1], &bucket_st[d - 1], pts[i]);
+      }
+    }
+
+    // sum_{d} d * bucket[d] = sum_{d} (bucket[d] + ... + bucket[max])
+    EcPoint running;
+    EcPoint window_sum;
+    uint8_t running_st = 0;
+    uint8_t window_sum_st = 0;
+    for (size_t d = num_buckets; d-- > 0;) {
+      if (bucket_st[d] != 0) {
+        accumulate(&running, &running_st, buckets[d]);
+      }
+      if (running_st != 0) {
+        accumulate(&window_sum, &window_sum_st, running);
+      }
+    }
+    if (window_sum_st != 0) {
+      accumulate(&res, &res_st, window_sum);
+    }
+  }
+
+  if (res_st == 0) {
+    return MulBase(0_mp);
+  }
+  // never hand out an alias of the input points
+  return res_st == 1 ? Add(res, MulBase(0_mp)) : res;
+}
+
+std::shared_ptr<const FixedBaseTable> EcGroupSketch::CreateFixedBaseTable(
+    const EcPoint &point, size_t window_bits) const {
+  YACL_ENFORCE(window_bits >= 1 && window_bits <= 16,
+               "window_bits must in [1, 16], got {}", window_bits);
+  auto table = std::make_shared<WindowedTable>();
+  table->curve = GetCurveName();
+  table->window_bits = window_bits;
+  table->num_windows =
+      (GetOrder().BitCount() + window_bits - 1) / window_bits;
+
+  size_t row_size = (static_cast<size_t>(1) << window_bits) - 1;
+  auto &points = table->points;
+  points.reserve(table->num_windows * row_size);
+  // copy the point, so that later changes of the input won't leak in
+  auto base = Add(point, MulBase(0_mp));
+  for (size_t i = 0; i < table->num_windows; ++i) {
+    points.emplace_back(base);
+    for (size_t d = 1; d < row_size; ++d) {
+      points.emplace_back(Add(points.back(), base));
+    }
+    // next base = 2^w * base = 2 * (2^(w-1) * base)
+    base = Double(points[i * row_size + (row_size >> 1)]);
+  }
+  // additions with normalized points are cheaper on some libs
+  BatchNormalize(absl::MakeSpan(points));
+  return table;
+}
+
+EcPoint EcGroupSketch::MulFixedBase(const FixedBaseTable &table,
+                                    const MPInt &scalar) const {
+  const auto *t = dynamic_cast<const WindowedTable *>(&table);
+  YACL_ENFORCE(t != nullptr && t->curve == GetCurveName(),
+               "The table is not created by {} lib on curve {}",
+               GetLibraryName(), GetCurveName());
+
+  thread_local MPInt k;
+  MPInt::Mod(scalar, GetOrder(), &k);
+  size_t byte_len = (t->num_windows * t->window_bits + 7) / 8;
+  auto buf = k.ToBytes(byte_len, Endian::little);
+
+  // state of res: 0 -> empty, 1 -> aliases a table point (read only), 2 ->
+  // owns a freshly computed point (can be updated in place)
+  EcPoint res;
+  uint8_t res_st = 0;
+  size_t row_size = (static_cast<size_t>(1) << t->window_bits) - 1;
+  for (size_t i = 0; i < t->num_windows; ++i) {
+    size_t d = GetWindow(buf.data<uint8_t>(), byte_len, i * t->window_bits,
+                         t->window_bits);
+    if (d == 0) {
+      continue;
+    }
+    const auto &p = t->points[i * row_size + d - 1];
+    switch (res_st) {
+      case 0:
+        res = p;
+        res_st = 1;
+        break;
+      case 1:
+        res = Add(res, p);
+        res_st = 2;
+        break;
+      default:
+        AddInplace(&res, p);
+    }
+  }
+
+  if (res_st == 0) {
+    return MulBase(0_mp);
+  }
+  // never hand out an alias of the table points
+  return res_st == 1 ? Add(res, MulBase(0_mp)) : res;
+}
+
 EcPoint EcGroupSketch::Div(const EcPoint &point, const MPInt &scalar) const {
   YACL_ENFORCE(!scalar.IsZero(), "Ecc point can not div by zero!");
 
@@ -72,4 +316,134 @@ void EcGroupSketch::NegateInplace(EcPoint *point) const {
   *point = Negate(*point);
 }
 
+bool EcGroupSketch::IsInCurveGroup(absl::Span<const EcPoint> points) const {
+  return std::all_of(points.begin(), points.end(), [this](const EcPoint &p) {
+    return IsInCurveGroup(p);
+  });
+}
+
+std::vector<Buffer> EcGroupSketch::SerializePoints(
+    absl::Span<const EcPoint> points, PointOctetFormat format) const {
+  std::vector<Buffer> res(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    SerializePoint(points[i], format, &res[i]);
+  }
+  return res;
+}
+
+std::vector<size_t> EcGroupSketch::HashPoints(
+    absl::Span<const EcPoint> points) const {
+  std::vector<size_t> res(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    res[i] = HashPoint(points[i]);
+  }
+  return res;
+}
+
+size_t EcGroupSketch::PointArrayFieldBytes() const {
+  return (GetField().BitCount() + 7) / 8;
+}
+
+void EcGroupSketch::StorePoints(absl::Span<const EcPoint> points,
+                                EcPointArray *array, size_t offset) const {
+  size_t field_bytes = array->FieldBytes();
+  for (size_t i = 0; i < points.size(); ++i) {
+    auto slot = (*array)[offset + i];
+    if (IsInfinity(points[i])) {
+      std::memset(slot.data(), 0, slot.size());
+      continue;
+    }
+    auto p = GetAffinePoint(points[i]);
+    slot[0] = 0x04;
+    p.x.ToBytes(slot.data() + 1, field_bytes, Endian::big);
+    p.y.ToBytes(slot.data() + 1 + field_bytes, field_bytes, Endian::big);
+  }
+}
+
+void EcGroupSketch::LoadPoint(const EcPointArray &array, size_t idx,
+                              EcPoint *point) const {
+  auto slot = array[idx];
+  if (slot[0] == 0) {
+    *point = AffinePoint();
+    return;
+  }
+  YACL_ENFORCE(slot[0] == 0x04, "Bad EcPointArray slot, prefix={}", slot[0]);
+  size_t field_bytes = array.FieldBytes();
+  AffinePoint p;
+  p.x.FromMagBytes({slot.data() + 1, field_bytes}, Endian::big);
+  p.y.FromMagBytes({slot.data() + 1 + field_bytes, field_bytes}, Endian::big);
+  *point = std::move(p);
+}
+
+EcPointArray EcGroupSketch::ToPointArray(
+    absl::Span<const EcPoint> points) const {
+  EcPointArray res(points.size(), PointArrayFieldBytes());
+  ForEachBlock(points.size(), [&](int64_t beg, int64_t end,
+                                  std::vector<EcPoint> *) {
+    StorePoints(points.subspan(beg, end - beg), &res, beg);
+  });
+  return res;
+}
+
+EcPoint EcGroupSketch::GetPoint(const EcPointArray &array, size_t idx) const {
+  YACL_ENFORCE_LT(idx, array.Size());
+  EcPoint res;
+  LoadPoint(array, idx, &res);
+  return res;
+}
+
+EcPointArray EcGroupSketch::BatchMulBase(
+    absl::Span<const MPInt> scalars) const {
+  EcPointArray res(scalars.size(), PointArrayFieldBytes());
+  ForEachBlock(scalars.size(), [&](int64_t beg, int64_t end,
+                                   std::vector<EcPoint> *scratch) {
+    scratch->resize(end - beg);
+    for (int64_t i = beg; i < end; ++i) {
+      (*scratch)[i - beg] = MulBase(scalars[i]);
+    }
+    StorePoints(*scratch, &res, beg);
+  });
+  return res;
+}
+
+EcPointArray EcGroupSketch::BatchMul(const EcPointArray &points,
+                                     const MPInt &scalar) const {
+  YACL_ENFORCE_EQ(points.FieldBytes(), PointArrayFieldBytes(),
+                  "EcPointArray is not from this curve");
+  EcPointArray res(points.Size(), points.FieldBytes());
+  ForEachBlock(points.Size(), [&](int64_t beg, int64_t end,
+                                  std::vector<EcPoint> *scratch) {
+    scratch->resize(end - beg);
+    for (int64_t i = beg; i < end; ++i) {
+      auto *p = &(*scratch)[i - beg];
+      LoadPoint(points, i, p);
+      MulInplace(p, scalar);
+    }
+    StorePoints(*scratch, &res, beg);
+  });
+  return res;
+}
+
+EcPointArray EcGroupSketch::BatchAdd(const EcPointArray &p1,
+                                     const EcPointArray &p2) const {
+  YACL_ENFORCE_EQ(p1.Size(), p2.Size(), "BatchAdd: size mismatch");
+  YACL_ENFORCE(p1.FieldBytes() == PointArrayFieldBytes() &&
+                   p2.FieldBytes() == PointArrayFieldBytes(),
+               "EcPointArray is not from this curve");
+  EcPointArray res(p1.Size(), p1.FieldBytes());
+  ForEachBlock(p1.Size(), [&](int64_t beg, int64_t end,
+                              std::vector<EcPoint> *scratch) {
+    scratch->resize(end - beg);
+    EcPoint other;
+    for (int64_t i = beg; i < end; ++i) {
+      auto *p = &(*scratch)[i - beg];
+      LoadPoint(p1, i, p);
+      LoadPoint(p2, i, &other);
+      AddInplace(p, other);
+    }
+    StorePoints(*scratch, &res, beg);
+  });
+  return res;
+}
+
 }  // namespace yacl::crypto
@@ -44,15 +44,58 @@ class EcGroupSketch : public EcGroup {
   void MulInplace(EcPoint *point, const MPInt &scalar) const override;
   EcPoint MulDoubleBase(const MPInt &s1, const MPInt &s2,
                         const EcPoint &p2) const override;
+  // Generic Pippenger (bucket) method, built on Add/Double
+  EcPoint MultiScalarMul(absl::Span<const EcPoint> points,
+                         absl::Span<const MPInt> scalars) const override;
+  using EcGroup::CreateFixedBaseTable;
+  // Generic windowed tables, built on Add/Double
+  std::shared_ptr<const FixedBaseTable> CreateFixedBaseTable(
+      const EcPoint &point, size_t window_bits) const override;
+  EcPoint MulFixedBase(const FixedBaseTable &table,
+                       const MPInt &scalar) const override;
   EcPoint Div(const EcPoint &point, const MPInt &scalar) const override;
 
   void DivInplace(EcPoint *point, const MPInt &scalar) const override;
 
   void NegateInplace(EcPoint *point) const override;
 
+  using EcGroup::IsInCurveGroup;
+  // Check points one by one
+  bool IsInCurveGroup(absl::Span<const EcPoint> points) const override;
+
+  using EcGroup::SerializePoints;
+  // Serialize/hash points one by one
+  std::vector<Buffer> SerializePoints(absl::Span<const EcPoint> points,
+                                      PointOctetFormat format) const override;
+  std::vector<size_t> HashPoints(
+      absl::Span<const EcPoint> points) const override;
+  // Do nothing
+  void BatchNormalize(absl::Span<EcPoint> points) const override {}
+
+  // Generic EcPointArray ops, built on StorePoints/LoadPoint below
+  EcPointArray ToPointArray(absl::Span<const EcPoint> points) const override;
+  EcPoint GetPoint(const EcPointArray &array, size_t idx) const override;
+  EcPointArray BatchMulBase(absl::Span<const MPInt> scalars) const override;
+  EcPointArray BatchMul(const EcPointArray &points,
+                        const MPInt &scalar) const override;
+  EcPointArray BatchAdd(const EcPointArray &p1,
+                        const EcPointArray &p2) const override;
+
  protected:
   explicit EcGroupSketch(CurveMeta meta) : meta_(std::move(meta)) {}
 
+  // Size of a coordinate in EcPointArray
+  size_t PointArrayFieldBytes() const;
+  // Write points into slots [offset, offset + points.size()) of array.
+  // The default goes through GetAffinePoint() one by one.
+  virtual void StorePoints(absl::Span<const EcPoint> points,
+                           EcPointArray *array, size_t offset) const;
+  // Load array[idx] into *point. Libs may reuse the storage held by *point,
+  // so it must not be shared with other EcPoint copies.
+  // The default builds EcPoint<AffinePoint>, which suits the toy libs.
+  virtual void LoadPoint(const EcPointArray &array, size_t idx,
+                         EcPoint *point) const;
+
   CurveMeta meta_;
 };
 
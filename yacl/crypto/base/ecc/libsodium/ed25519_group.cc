@@ -0,0 +1,221 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/base/ecc/libsodium/ed25519_group.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "sodium.h"
+
+#include "yacl/crypto/base/hash/ssl_hash.h"
+
+namespace yacl::crypto::sodium {
+
+namespace {
+
+constexpr size_t kHashToCurveCounterGuard = 100;
+
+// The identity (0, 1)
+const Array32 kIdentity = {1};
+
+// d = -121665 / 121666
+const MPInt &CurveD(const MPInt &p) {
+  static const MPInt d =
+      (p - 121665_mp).MulMod((121666_mp).InvertMod(p), p);
+  return d;
+}
+
+}  // namespace
+
+Ed25519Group::Ed25519Group(const CurveMeta &meta) : SodiumGroup(meta) {
+  generator_ = MulBase(1_mp);
+}
+
+const EcPoint &Ed25519Group::GetGenerator() const { return generator_; }
+
+std::string Ed25519Group::ToString() {
+  return fmt::format("{} ==> -x^2 + y^2 = 1 + {}x^2y^2 (mod {})",
+                     GetCurveName(), CurveD(GetField()), GetField());
+}
+
+EcPoint Ed25519Group::Add(const EcPoint &p1, const EcPoint &p2) const {
+  EcPoint r(std::in_place_type<Array32>);
+  YACL_ENFORCE(crypto_core_ed25519_add(PointBytes(&r), PointBytes(p1),
+                                       PointBytes(p2)) == 0,
+               "libsodium: add invalid ed25519 points");
+  return r;
+}
+
+EcPoint Ed25519Group::Sub(const EcPoint &p1, const EcPoint &p2) const {
+  EcPoint r(std::in_place_type<Array32>);
+  YACL_ENFORCE(crypto_core_ed25519_sub(PointBytes(&r), PointBytes(p1),
+                                       PointBytes(p2)) == 0,
+               "libsodium: sub invalid ed25519 points");
+  return r;
+}
+
+void Ed25519Group::SubInplace(EcPoint *p1, const EcPoint &p2) const {
+  *p1 = Sub(*p1, p2);
+}
+
+EcPoint Ed25519Group::Double(const EcPoint &p) const { return Add(p, p); }
+
+void Ed25519Group::DoubleInplace(EcPoint *p) const { *p = Add(*p, *p); }
+
+void Ed25519Group::ToScalarBytes(const MPInt &scalar,
+                                 unsigned char *buf) const {
+  (scalar % GetOrder()).ToBytes(buf, crypto_core_ed25519_SCALARBYTES,
+                                Endian::little);
+}
+
+EcPoint Ed25519Group::MulBase(const MPInt &scalar) const {
+  unsigned char n[crypto_core_ed25519_SCALARBYTES];
+  ToScalarBytes(scalar, n);
+  // libsodium rejects zero scalars, whose result is the identity
+  if (std::all_of(n, n + sizeof(n), [](unsigned char c) { return c == 0; })) {
+    return kIdentity;
+  }
+
+  EcPoint r(std::in_place_type<Array32>);
+  YACL_ENFORCE(crypto_scalarmult_ed25519_base_noclamp(PointBytes(&r), n) == 0,
+               "libsodium: MulBase fail");
+  return r;
+}
+
+EcPoint Ed25519Group::Mul(const EcPoint &point, const MPInt &scalar) const {
+  unsigned char n[crypto_core_ed25519_SCALARBYTES];
+  ToScalarBytes(scalar, n);
+  // libsodium rejects the identity and zero scalars
+  if (IsInfinity(point) || std::all_of(n, n + sizeof(n), [](unsigned char c) {
+        return c == 0;
+      })) {
+    return kIdentity;
+  }
+
+  EcPoint r(std::in_place_type<Array32>);
+  YACL_ENFORCE(
+      crypto_scalarmult_ed25519_noclamp(PointBytes(&r), n, PointBytes(point)) ==
+          0,
+      "libsodium: Mul fail, the point is not in the prime-order subgroup");
+  return r;
+}
+
+void Ed25519Group::MulInplace(EcPoint *point, const MPInt &scalar) const {
+  *point = Mul(*point, scalar);
+}
+
+EcPoint Ed25519Group::Negate(const EcPoint &point) const {
+  return Sub(kIdentity, point);
+}
+
+AffinePoint Ed25519Group::GetAffinePoint(const EcPoint &point) const {
+  // RFC 8032, section 5.1.3
+  const auto &p = GetField();
+  const auto *buf = PointBytes(point);
+  bool x_odd = (buf[31] >> 7) != 0;
+  Array32 y_buf = std::get<Array32>(point);
+  y_buf[31] &= 0x7f;
+  MPInt y;
+  y.FromMagBytes({y_buf.data(), y_buf.size()}, Endian::little);
+
+  // x^2 = (y^2 - 1) / (d * y^2 + 1)
+  auto yy = y.MulMod(y, p);
+  auto u = yy.SubMod(1_mp, p);
+  auto v = CurveD(p).MulMod(yy, p).AddMod(1_mp, p);
+  auto xx = u.MulMod(v.InvertMod(p), p);
+  auto x = xx.PowMod((p + 3_mp) / 8_mp, p);
+  if (x.MulMod(x, p) != xx) {
+    // multiply by sqrt(-1) = 2^((p - 1) / 4)
+    x = x.MulMod((2_mp).PowMod((p - 1_mp) / 4_mp, p), p);
+  }
+  YACL_ENFORCE(x.MulMod(x, p) == xx, "Invalid ed25519 point");
+  if (x.IsOdd() != x_odd) {
+    x = p - x;
+  }
+  return {x % p, y};
+}
+
+EcPoint Ed25519Group::HashToCurve(HashToCurveStrategy strategy,
+                                  std::string_view str) const {
+  YACL_ENFORCE(strategy == HashToCurveStrategy::TryAndRehash_SHA2,
+               "{} lib only support TryAndRehash_SHA2 strategy on {} now. "
+               "select={}",
+               GetLibraryName(), GetCurveName(), (int)strategy);
+
+  auto buf = SslHash(HashAlgorithm::SHA512).Update(str).CumulativeHash();
+  unsigned char p2[crypto_core_ed25519_BYTES];
+  unsigned char p4[crypto_core_ed25519_BYTES];
+  for (size_t t = 0; t < kHashToCurveCounterGuard; ++t) {
+    // crypto_core_ed25519_add() fails iff the candidate does not decode to a
+    // point on the curve
+    if (crypto_core_ed25519_add(p2, buf.data(), buf.data()) == 0) {
+      // clear the cofactor: 8P = 2(2(2P))
+      EcPoint res(std::in_place_type<Array32>);
+      YACL_ENFORCE(crypto_core_ed25519_add(p4, p2, p2) == 0);
+      YACL_ENFORCE(crypto_core_ed25519_add(PointBytes(&res), p4, p4) == 0);
+      if (!IsInfinity(res)) {
+        return res;
+      }
+    }
+
+    // do rehash
+    buf = SslHash(HashAlgorithm::SHA512).Update(buf).CumulativeHash();
+  }
+
+  YACL_THROW("{} HashToCurve exceed max loop({})", GetLibraryName(),
+             kHashToCurveCounterGuard);
+}
+
+bool Ed25519Group::IsInCurveGroup(const EcPoint &point) const {
+  if (IsInfinity(point)) {
+    return true;
+  }
+  if (crypto_core_ed25519_is_valid_point(PointBytes(point)) != 1) {
+    return false;
+  }
+  // is_valid_point() of libsodium 1.0.18 lets a torsion component through, so
+  // check l * P = O explicitly. scalarmult returns -1 iff the result is O.
+  unsigned char order[crypto_core_ed25519_SCALARBYTES];
+  unsigned char res[crypto_core_ed25519_BYTES];
+  GetOrder().ToBytes(order, sizeof(order), Endian::little);
+  return crypto_scalarmult_ed25519_noclamp(res, order, PointBytes(point)) ==
+         -1;
+}
+
+bool Ed25519Group::IsInfinity(const EcPoint &point) const {
+  return std::memcmp(PointBytes(point), kIdentity.data(), sizeof(Array32)) ==
+         0;
+}
+
+void Ed25519Group::LoadPoint(const EcPointArray &array, size_t idx,
+                             EcPoint *point) const {
+  auto slot = array[idx];
+  if (slot[0] == 0) {
+    *point = kIdentity;
+    return;
+  }
+  YACL_ENFORCE(slot[0] == 0x04, "Bad EcPointArray slot, prefix={}", slot[0]);
+  YACL_ENFORCE_EQ(array.FieldBytes(), sizeof(Array32));
+
+  // y in little-endian, with the parity of x in the top bit
+  Array32 buf;
+  const auto *x = slot.data() + 1;
+  const auto *y = x + sizeof(Array32);
+  std::reverse_copy(y, y + sizeof(Array32), buf.begin());
+  buf[31] |= (x[sizeof(Array32) - 1] & 1) << 7;
+  *point = buf;
+}
+
+}  // namespace yacl::crypto::sodium
@@ -0,0 +1,71 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "yacl/crypto/base/ecc/libsodium/sodium_group.h"
+
+namespace yacl::crypto::sodium {
+
+// Ed25519 (RFC 8032 curve) group of prime order l, built on the
+// crypto_core_ed25519 and crypto_scalarmult_ed25519 API of libsodium.
+//
+// Add() and Mul() accept any point on the curve, including points with a
+// torsion component; use IsInCurveGroup() to validate untrusted points.
+class Ed25519Group : public SodiumGroup {
+ public:
+  explicit Ed25519Group(const CurveMeta &meta);
+
+  const EcPoint &GetGenerator() const override;
+  std::string ToString() override;
+
+  EcPoint Add(const EcPoint &p1, const EcPoint &p2) const override;
+  EcPoint Sub(const EcPoint &p1, const EcPoint &p2) const override;
+  void SubInplace(EcPoint *p1, const EcPoint &p2) const override;
+  EcPoint Double(const EcPoint &p) const override;
+  void DoubleInplace(EcPoint *p) const override;
+
+  EcPoint MulBase(const MPInt &scalar) const override;
+  EcPoint Mul(const EcPoint &point, const MPInt &scalar) const override;
+  void MulInplace(EcPoint *point, const MPInt &scalar) const override;
+
+  EcPoint Negate(const EcPoint &point) const override;
+
+  // Decompress the point, slow
+  AffinePoint GetAffinePoint(const EcPoint &point) const override;
+
+  // Only TryAndRehash_SHA2 (with SHA-512) is supported. The candidate is
+  // multiplied by the cofactor, so the output is in the prime-order subgroup.
+  EcPoint HashToCurve(HashToCurveStrategy strategy,
+                      std::string_view str) const override;
+
+  using EcGroupSketch::IsInCurveGroup;
+  // Canonical encoding of a point in the prime-order subgroup
+  bool IsInCurveGroup(const EcPoint &point) const override;
+  bool IsInfinity(const EcPoint &point) const override;
+
+ protected:
+  void LoadPoint(const EcPointArray &array, size_t idx,
+                 EcPoint *point) const override;
+
+ private:
+  // Scalar mod l, in 32 little-endian bytes
+  void ToScalarBytes(const MPInt &scalar, unsigned char *buf) const;
+
+  EcPoint generator_;
+};
+
+}  // namespace yacl::crypto::sodium
@@ -0,0 +1,130 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <set>
+#include <string>
+
+#include "absl/strings/escaping.h"
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/base/ecc/libsodium/ed25519_group.h"
+#include "yacl/crypto/base/hash/ssl_hash.h"
+
+namespace yacl::crypto::sodium::test {
+
+class Ed25519Test : public ::testing::Test {
+ protected:
+  std::unique_ptr<EcGroup> ec_ =
+      std::make_unique<Ed25519Group>(GetCurveMetaByName("ed25519"));
+};
+
+TEST_F(Ed25519Test, MetaWorks) {
+  EXPECT_STRCASEEQ(ec_->GetLibraryName().c_str(), "libsodium");
+  EXPECT_EQ(
+      ec_->GetField(),
+      "0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed"_mp);
+  EXPECT_EQ(
+      ec_->GetOrder(),
+      "0x1000000000000000000000000000000014def9dea2f79cd65812631a5cf5d3ed"_mp);
+  EXPECT_EQ(ec_->GetCofactor(), 8_mp);
+
+  // RFC 8032, section 5.1: B = (x, 4/5)
+  auto g = ec_->GetAffinePoint(ec_->GetGenerator());
+  EXPECT_EQ(g.x,
+            "1511222134953540077250115140958853151145401269304185720604611328"
+            "3949847762202"_mp);
+  EXPECT_EQ(g.y,
+            "4631683569492647816942839400347516314130799386625622561578303360"
+            "3165251855960"_mp);
+  // -B = (-x, y)
+  auto neg = ec_->GetAffinePoint(ec_->Negate(ec_->GetGenerator()));
+  EXPECT_EQ(neg.x, ec_->GetField() - g.x);
+  EXPECT_EQ(neg.y, g.y);
+  EXPECT_EQ(ec_->GetAffinePoint(ec_->MulBase(0_mp)), AffinePoint(0_mp, 1_mp));
+}
+
+// The test cases below are come from RFC 8032, section 7.1
+TEST_F(Ed25519Test, PublicKeyWorks) {
+  auto check = [&](absl::string_view sk, absl::string_view pk) {
+    auto h = SslHash(HashAlgorithm::SHA512)
+                 .Update(absl::HexStringToBytes(sk))
+                 .CumulativeHash();
+    h[0] &= 248;
+    h[31] &= 127;
+    h[31] |= 64;
+    MPInt a;
+    a.FromMagBytes(ByteContainerView(h.data(), 32), Endian::little);
+
+    auto buf = ec_->SerializePoint(ec_->MulBase(a));
+    EXPECT_EQ(absl::BytesToHexString(
+                  absl::string_view(buf.data<char>(), buf.size())),
+              pk);
+    auto p = ec_->DeserializePoint(absl::HexStringToBytes(pk));
+    EXPECT_TRUE(ec_->IsInCurveGroup(p));
+    EXPECT_TRUE(ec_->PointEqual(p, ec_->MulBase(a)));
+  };
+
+  check("9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+        "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a");
+  check("4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+        "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c");
+  check("c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+        "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025");
+}
+
+TEST_F(Ed25519Test, IsInCurveGroupWorks) {
+  EXPECT_TRUE(ec_->IsInCurveGroup(ec_->GetGenerator()));
+  EXPECT_TRUE(ec_->IsInfinity(ec_->MulBase(ec_->GetOrder())));
+
+  // (0, -1) is a point of order 2
+  Array32 low_order = {};
+  low_order[0] = static_cast<char>(0xec);
+  for (size_t i = 1; i < 31; ++i) {
+    low_order[i] = static_cast<char>(0xff);
+  }
+  low_order[31] = 0x7f;
+  EXPECT_FALSE(ec_->IsInCurveGroup(low_order));
+  EXPECT_ANY_THROW(ec_->Mul(low_order, 3_mp));
+
+  // a valid point plus a torsion component is on the curve but out of the
+  // prime-order subgroup
+  auto mixed = ec_->Add(ec_->MulBase(5_mp), low_order);
+  EXPECT_FALSE(ec_->IsInCurveGroup(mixed));
+  EXPECT_TRUE(ec_->IsInCurveGroup(ec_->Add(mixed, low_order)));
+
+  // y = 2 is not on the curve
+  Array32 not_on_curve = {2};
+  EXPECT_FALSE(ec_->IsInCurveGroup(not_on_curve));
+  EXPECT_ANY_THROW(ec_->Add(not_on_curve, ec_->GetGenerator()));
+}
+
+TEST_F(Ed25519Test, HashToCurveWorks) {
+  std::set<std::string> seen;
+  for (int i = 0; i < 100; ++i) {
+    auto str = fmt::format("id_{}", i);
+    auto p = ec_->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2, str);
+    ASSERT_TRUE(ec_->IsInCurveGroup(p));
+    ASSERT_FALSE(ec_->IsInfinity(p));
+    ASSERT_TRUE(ec_->PointEqual(
+        p, ec_->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2, str)));
+    auto buf = ec_->SerializePoint(p);
+    seen.emplace(buf.data<char>(), buf.size());
+  }
+  EXPECT_EQ(seen.size(), 100);
+
+  EXPECT_ANY_THROW(
+      ec_->HashToCurve(HashToCurveStrategy::HashAsPointX_SHA2, "abc"));
+}
+
+}  // namespace yacl::crypto::sodium::test
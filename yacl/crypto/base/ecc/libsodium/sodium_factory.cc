@@ -0,0 +1,47 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include "sodium.h"
+
+#include "yacl/crypto/base/ecc/libsodium/ed25519_group.h"
+#include "yacl/crypto/base/ecc/libsodium/x25519_group.h"
+
+namespace yacl::crypto::sodium {
+
+namespace {
+
+std::unique_ptr<EcGroup> Create(const CurveMeta &meta) {
+  // sodium_init() is thread-safe and can be called multiple times
+  YACL_ENFORCE(sodium_init() >= 0, "libsodium init fail");
+  if (meta.LowerName() == "ed25519") {
+    return std::make_unique<Ed25519Group>(meta);
+  }
+  YACL_ENFORCE(meta.LowerName() == "curve25519",
+               "curve {} not supported by libsodium", meta.name);
+  return std::make_unique<X25519Group>(meta);
+}
+
+bool IsSupported(const CurveMeta &meta) {
+  return meta.LowerName() == "ed25519" || meta.LowerName() == "curve25519";
+}
+
+// Constant-time field arithmetic specialized for 2^255 - 19, much faster
+// than the generic implementations of other libs
+REGISTER_EC_LIBRARY(kLibName, 200, IsSupported, Create);
+
+}  // namespace
+
+}  // namespace yacl::crypto::sodium
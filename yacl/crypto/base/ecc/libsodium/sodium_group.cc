@@ -0,0 +1,115 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/base/ecc/libsodium/sodium_group.h"
+
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace yacl::crypto::sodium {
+
+namespace {
+
+const MPInt kCofactor = 8_mp;
+// p = 2^255 - 19
+const MPInt kField = (2_mp).Pow(255) - 19_mp;
+// l = 2^252 + 27742317777372353535851937790883648493
+const MPInt kOrder =
+    (2_mp).Pow(252) + "0x14def9dea2f79cd65812631a5cf5d3ed"_mp;
+
+struct SodiumFixedBaseTable final : public FixedBaseTable {
+  CurveName curve;
+  EcPoint point;
+};
+
+}  // namespace
+
+const unsigned char *PointBytes(const EcPoint &p) {
+  YACL_ENFORCE(
+      std::holds_alternative<Array32>(p),
+      "Unsupported EcPoint type, expected Array32, real type index is {}",
+      p.index());
+  return reinterpret_cast<const unsigned char *>(std::get<Array32>(p).data());
+}
+
+unsigned char *PointBytes(EcPoint *p) {
+  YACL_ENFORCE(
+      std::holds_alternative<Array32>(*p),
+      "Unsupported EcPoint type, expected Array32, real type index is {}",
+      p->index());
+  return reinterpret_cast<unsigned char *>(std::get<Array32>(*p).data());
+}
+
+std::string SodiumGroup::GetLibraryName() const { return kLibName; }
+
+const MPInt &SodiumGroup::GetCofactor() const { return kCofactor; }
+
+const MPInt &SodiumGroup::GetField() const { return kField; }
+
+const MPInt &SodiumGroup::GetOrder() const { return kOrder; }
+
+Buffer SodiumGroup::SerializePoint(const EcPoint &point,
+                                   PointOctetFormat format) const {
+  Buffer buf;
+  SerializePoint(point, format, &buf);
+  return buf;
+}
+
+void SodiumGroup::SerializePoint(const EcPoint &point, PointOctetFormat format,
+                                 Buffer *buf) const {
+  YACL_ENFORCE(format == PointOctetFormat::Autonomous,
+               "{} lib do not support {} format", kLibName, (int)format);
+  buf->resize(sizeof(Array32));
+  std::memcpy(buf->data(), PointBytes(point), sizeof(Array32));
+}
+
+EcPoint SodiumGroup::DeserializePoint(ByteContainerView buf,
+                                      PointOctetFormat format) const {
+  YACL_ENFORCE(format == PointOctetFormat::Autonomous,
+               "{} lib do not support {} format", kLibName, (int)format);
+  YACL_ENFORCE_EQ(buf.size(), sizeof(Array32), "Bad point size");
+  EcPoint p(std::in_place_type<Array32>);
+  std::memcpy(PointBytes(&p), buf.data(), sizeof(Array32));
+  return p;
+}
+
+std::shared_ptr<const FixedBaseTable> SodiumGroup::CreateFixedBaseTable(
+    const EcPoint &point, size_t window_bits) const {
+  PointBytes(point);  // check the type
+  auto table = std::make_shared<SodiumFixedBaseTable>();
+  table->curve = GetCurveName();
+  table->point = point;
+  return table;
+}
+
+EcPoint SodiumGroup::MulFixedBase(const FixedBaseTable &table,
+                                  const MPInt &scalar) const {
+  const auto *t = dynamic_cast<const SodiumFixedBaseTable *>(&table);
+  YACL_ENFORCE(t != nullptr && t->curve == GetCurveName(),
+               "The table is not created by {} lib on curve {}", kLibName,
+               GetCurveName());
+  return Mul(t->point, scalar);
+}
+
+size_t SodiumGroup::HashPoint(const EcPoint &point) const {
+  return std::hash<std::string_view>{}(
+      {reinterpret_cast<const char *>(PointBytes(point)), sizeof(Array32)});
+}
+
+bool SodiumGroup::PointEqual(const EcPoint &p1, const EcPoint &p2) const {
+  return std::memcmp(PointBytes(p1), PointBytes(p2), sizeof(Array32)) == 0;
+}
+
+}  // namespace yacl::crypto::sodium
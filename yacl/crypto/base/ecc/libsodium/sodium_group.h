@@ -0,0 +1,67 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "yacl/crypto/base/ecc/group_sketch.h"
+
+namespace yacl::crypto::sodium {
+
+static const std::string kLibName = "libsodium";
+
+// Base class of the libsodium lib, which serves the curves over the field
+// 2^255 - 19 with constant-time radix-2^51 arithmetic.
+//
+// An EcPoint of this lib is an Array32 holding the canonical 32-byte encoding
+// of the point, so points are cheap to copy, compare, hash and serialize.
+class SodiumGroup : public EcGroupSketch {
+ public:
+  std::string GetLibraryName() const override;
+
+  const MPInt &GetCofactor() const override;
+  const MPInt &GetField() const override;
+  const MPInt &GetOrder() const override;
+
+  // Only PointOctetFormat::Autonomous is supported, that is the 32 bytes
+  // encoding defined by each curve
+  Buffer SerializePoint(const EcPoint &point,
+                        PointOctetFormat format) const override;
+  void SerializePoint(const EcPoint &point, PointOctetFormat format,
+                      Buffer *buf) const override;
+  EcPoint DeserializePoint(ByteContainerView buf,
+                           PointOctetFormat format) const override;
+
+  using EcGroupSketch::CreateFixedBaseTable;
+  // The public API of libsodium has no precomputed multiplication and each
+  // Add decodes both points, so the generic tables are slower than Mul().
+  // The table only keeps the point and MulFixedBase() is Mul().
+  std::shared_ptr<const FixedBaseTable> CreateFixedBaseTable(
+      const EcPoint &point, size_t window_bits) const override;
+  EcPoint MulFixedBase(const FixedBaseTable &table,
+                       const MPInt &scalar) const override;
+
+  size_t HashPoint(const EcPoint &point) const override;
+  bool PointEqual(const EcPoint &p1, const EcPoint &p2) const override;
+
+ protected:
+  explicit SodiumGroup(const CurveMeta &meta) : EcGroupSketch(meta) {}
+};
+
+// View of the encoding stored in an EcPoint
+const unsigned char *PointBytes(const EcPoint &p);
+unsigned char *PointBytes(EcPoint *p);
+
+}  // namespace yacl::crypto::sodium
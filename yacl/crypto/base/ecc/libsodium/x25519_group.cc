@@ -0,0 +1,130 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/base/ecc/libsodium/x25519_group.h"
+
+#include <algorithm>
+
+#include "sodium.h"
+
+#include "yacl/crypto/base/hash/ssl_hash.h"
+
+namespace yacl::crypto::sodium {
+
+namespace {
+
+// Low 256 bits of |scalar| in little-endian, libsodium will clamp it
+void ToScalarBytes(const MPInt &scalar, unsigned char *buf) {
+  MPInt k = scalar.Abs();
+  k.ToBytes(buf, crypto_scalarmult_curve25519_SCALARBYTES, Endian::little);
+}
+
+}  // namespace
+
+X25519Group::X25519Group(const CurveMeta &meta) : SodiumGroup(meta) {
+  generator_ = Array32{9};
+}
+
+const EcPoint &X25519Group::GetGenerator() const { return generator_; }
+
+std::string X25519Group::ToString() {
+  return fmt::format("{} ==> y^2 = x^3 + 486662x^2 + x (mod {})",
+                     GetCurveName(), GetField());
+}
+
+EcPoint X25519Group::Add(const EcPoint &p1, const EcPoint &p2) const {
+  YACL_THROW(
+      "{} from {} do not support Add, because p1, p2 only has X-coordinate",
+      GetCurveName(), GetLibraryName());
+}
+
+EcPoint X25519Group::MulBase(const MPInt &scalar) const {
+  unsigned char n[crypto_scalarmult_curve25519_SCALARBYTES];
+  ToScalarBytes(scalar, n);
+  EcPoint r(std::in_place_type<Array32>);
+  YACL_ENFORCE(crypto_scalarmult_curve25519_base(PointBytes(&r), n) == 0,
+               "libsodium: MulBase fail");
+  return r;
+}
+
+EcPoint X25519Group::Mul(const EcPoint &point, const MPInt &scalar) const {
+  unsigned char n[crypto_scalarmult_curve25519_SCALARBYTES];
+  ToScalarBytes(scalar, n);
+  EcPoint r(std::in_place_type<Array32>);
+  // libsodium returns -1 iff the result is the point at infinity (u = 0)
+  if (crypto_scalarmult_curve25519(PointBytes(&r), n, PointBytes(point)) !=
+      0) {
+    std::get<Array32>(r).fill(0);
+  }
+  return r;
+}
+
+void X25519Group::MulInplace(EcPoint *point, const MPInt &scalar) const {
+  *point = Mul(*point, scalar);
+}
+
+EcPoint X25519Group::Negate(const EcPoint &point) const {
+  // -P has the same u-coordinate as P
+  return point;
+}
+
+AffinePoint X25519Group::GetAffinePoint(const EcPoint &point) const {
+  AffinePoint ap;
+  ap.x.FromMagBytes({PointBytes(point), sizeof(Array32)}, Endian::little);
+  return ap;
+}
+
+EcPoint X25519Group::HashToCurve(HashToCurveStrategy strategy,
+                                 std::string_view str) const {
+  YACL_ENFORCE(strategy == HashToCurveStrategy::HashAsPointX_SHA2,
+               "{} lib only support HashAsPointX_SHA2 strategy on {} now. "
+               "select={}",
+               GetLibraryName(), GetCurveName(), (int)strategy);
+
+  auto buf = SslHash(HashAlgorithm::SHA256).Update(str).CumulativeHash();
+  // The digest is read as a big-endian integer, the same as the toy lib
+  EcPoint r(std::in_place_type<Array32>);
+  std::reverse_copy(buf.begin(), buf.begin() + sizeof(Array32),
+                    PointBytes(&r));
+  // RFC 7748: implementations MUST mask the most significant bit
+  PointBytes(&r)[31] &= 0x7f;
+  return r;
+}
+
+// Any u-coordinate in [0, p) is on curve25519 or on its twist, and we do not
+// distinguish between them, see the toy lib for details.
+bool X25519Group::IsInCurveGroup(const EcPoint &point) const {
+  MPInt u;
+  u.FromMagBytes({PointBytes(point), sizeof(Array32)}, Endian::little);
+  return u < GetField();
+}
+
+bool X25519Group::IsInfinity(const EcPoint &point) const {
+  const auto *u = PointBytes(point);
+  return std::all_of(u, u + sizeof(Array32),
+                     [](unsigned char c) { return c == 0; });
+}
+
+void X25519Group::LoadPoint(const EcPointArray &array, size_t idx,
+                            EcPoint *point) const {
+  YACL_ENFORCE_EQ(array.FieldBytes(), sizeof(Array32));
+  auto slot = array[idx];
+  EcPoint r(std::in_place_type<Array32>);
+  // an infinity slot is all zero, that is u = 0
+  std::reverse_copy(slot.data() + 1, slot.data() + 1 + sizeof(Array32),
+                    PointBytes(&r));
+  *point = r;
+}
+
+}  // namespace yacl::crypto::sodium
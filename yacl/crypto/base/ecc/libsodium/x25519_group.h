@@ -0,0 +1,60 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "yacl/crypto/base/ecc/libsodium/sodium_group.h"
+
+namespace yacl::crypto::sodium {
+
+// X25519 (RFC 7748) over curve25519, backed by crypto_scalarmult_curve25519.
+//
+// Points only carry the u-coordinate, so Add() is not supported. Scalars are
+// clamped as in RFC 7748 before the multiplication, the same as the toy lib.
+class X25519Group : public SodiumGroup {
+ public:
+  explicit X25519Group(const CurveMeta &meta);
+
+  const EcPoint &GetGenerator() const override;
+  std::string ToString() override;
+
+  EcPoint Add(const EcPoint &p1, const EcPoint &p2) const override;
+
+  EcPoint MulBase(const MPInt &scalar) const override;
+  EcPoint Mul(const EcPoint &point, const MPInt &scalar) const override;
+  void MulInplace(EcPoint *point, const MPInt &scalar) const override;
+
+  EcPoint Negate(const EcPoint &point) const override;
+
+  AffinePoint GetAffinePoint(const EcPoint &point) const override;
+
+  // Only HashAsPointX_SHA2 (with SHA-256) is supported
+  EcPoint HashToCurve(HashToCurveStrategy strategy,
+                      std::string_view str) const override;
+
+  using EcGroupSketch::IsInCurveGroup;
+  bool IsInCurveGroup(const EcPoint &point) const override;
+  bool IsInfinity(const EcPoint &point) const override;
+
+ protected:
+  void LoadPoint(const EcPointArray &array, size_t idx,
+                 EcPoint *point) const override;
+
+ private:
+  EcPoint generator_;
+};
+
+}  // namespace yacl::crypto::sodium
@@ -0,0 +1,143 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/base/ecc/libsodium/x25519_group.h"
+
+namespace yacl::crypto::sodium::test {
+
+class X25519Test : public ::testing::Test {
+ protected:
+  MPInt LeHex2Mp(std::string_view src) {
+    YACL_ENFORCE(src.size() % 2 == 0);
+    std::string result;
+    result.reserve(src.size());
+
+    for (std::size_t i = src.size(); i != 0; i -= 2) {
+      result.append(src, i - 2, 2);
+    }
+
+    return MPInt(result, 16);
+  }
+
+  EcPoint LeHex2Point(std::string_view src) {
+    auto u = LeHex2Mp(src);
+    Array32 p;
+    u.ToBytes(reinterpret_cast<unsigned char *>(p.data()), p.size(),
+              Endian::little);
+    return p;
+  }
+
+  std::unique_ptr<EcGroup> ec_ =
+      std::make_unique<X25519Group>(GetCurveMetaByName("curve25519"));
+};
+
+TEST_F(X25519Test, MetaWorks) {
+  EXPECT_STRCASEEQ(ec_->GetCurveName().c_str(), "curve25519");
+  EXPECT_STRCASEEQ(ec_->GetLibraryName().c_str(), "libsodium");
+  EXPECT_EQ(ec_->GetAffinePoint(ec_->GetGenerator()).x, 9_mp);
+  EXPECT_ANY_THROW(ec_->Add(ec_->GetGenerator(), ec_->GetGenerator()));
+}
+
+// The test cases below are come from RFC 7748
+TEST_F(X25519Test, X25519Works) {
+  // case 1
+  auto s = LeHex2Mp(
+      "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4");
+  auto p = LeHex2Point(
+      "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c");
+  auto exp = LeHex2Point(
+      "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552");
+  auto res = ec_->Mul(p, s);
+  EXPECT_TRUE(ec_->PointEqual(res, exp));
+
+  // case 2
+  s = LeHex2Mp(
+      "4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d");
+  p = LeHex2Point(
+      "e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a413");
+  exp = LeHex2Point(
+      "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957");
+  res = ec_->Mul(p, s);
+  EXPECT_TRUE(ec_->PointEqual(res, exp));
+  EXPECT_EQ(ec_->GetAffinePoint(res).x,
+            LeHex2Mp("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f76"
+                     "47aac7957"));
+
+  // Diffie-Hellman, RFC 7748 section 6.1
+  auto a = LeHex2Mp(
+      "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+  auto b = LeHex2Mp(
+      "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+  auto pa = ec_->MulBase(a);
+  auto pb = ec_->MulBase(b);
+  EXPECT_TRUE(ec_->PointEqual(
+      pa, LeHex2Point("8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a9"
+                      "8eaa9b4e6a")));
+  EXPECT_TRUE(ec_->PointEqual(
+      pb, LeHex2Point("de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e"
+                      "146f882b4f")));
+  auto k = LeHex2Point(
+      "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742");
+  EXPECT_TRUE(ec_->PointEqual(ec_->Mul(pa, b), k));
+  EXPECT_TRUE(ec_->PointEqual(ec_->Mul(pb, a), k));
+}
+
+TEST_F(X25519Test, SmallOrderWorks) {
+  // u = 0 and u = 1 have order 2 & 4, killed by the clamped scalar
+  for (const auto &u : {0_mp, 1_mp}) {
+    Array32 p;
+    u.ToBytes(reinterpret_cast<unsigned char *>(p.data()), p.size(),
+              Endian::little);
+    EXPECT_TRUE(ec_->IsInfinity(ec_->Mul(p, 12345_mp)));
+  }
+}
+
+TEST_F(X25519Test, CrossCheckWithToy) {
+  auto toy = EcGroupFactory::Create("curve25519", "toy");
+  for (int i = 0; i < 10; ++i) {
+    MPInt s;
+    MPInt::RandomExactBits(256, &s);
+    auto p = ec_->HashToCurve(HashToCurveStrategy::HashAsPointX_SHA2,
+                              fmt::format("id_{}", i));
+    auto toy_p = toy->HashToCurve(HashToCurveStrategy::HashAsPointX_SHA2,
+                                  fmt::format("id_{}", i));
+    // the toy lib masks the top bit of u in Mul()
+    auto toy_u = toy->GetAffinePoint(toy_p).x;
+    toy_u.SetBit(255, 0);
+    ASSERT_EQ(ec_->GetAffinePoint(p).x, toy_u);
+    ASSERT_EQ(ec_->GetAffinePoint(ec_->Mul(p, s)).x,
+              toy->GetAffinePoint(toy->Mul(toy_p, s)).x);
+    ASSERT_EQ(ec_->GetAffinePoint(ec_->MulBase(s)).x,
+              toy->GetAffinePoint(toy->MulBase(s)).x);
+  }
+}
+
+TEST_F(X25519Test, SerializeWorks) {
+  auto p = ec_->MulBase(12345_mp);
+  auto buf = ec_->SerializePoint(p);
+  EXPECT_EQ(buf.size(), 32);
+  EXPECT_TRUE(ec_->PointEqual(ec_->DeserializePoint(buf), p));
+  EXPECT_ANY_THROW(
+      ec_->SerializePoint(p, PointOctetFormat::X962Uncompressed));
+  EXPECT_ANY_THROW(ec_->DeserializePoint(ByteContainerView(buf.data(), 31)));
+
+  // the array slots keep the u-coordinate
+  auto array = ec_->ToPointArray({p, ec_->GetGenerator()});
+  EXPECT_TRUE(ec_->PointEqual(ec_->GetPoint(array, 0), p));
+  EXPECT_TRUE(ec_->PointEqual(ec_->GetPoint(array, 1), ec_->GetGenerator()));
+}
+
+}  // namespace yacl::crypto::sodium::test
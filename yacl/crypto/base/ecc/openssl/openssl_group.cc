@@ -14,12 +14,19 @@
 
 #include "yacl/crypto/base/ecc/openssl/openssl_group.h"
 
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
 #include "yacl/crypto/base/hash/ssl_hash.h"
 #include "yacl/utils/scope_guard.h"
 
 namespace yacl::crypto::openssl {
 
 static constexpr size_t kHashToCurveCounterGuard = 100;
+// EC_POINTs_mul is an interleaved wNAF (Straus) method, which is faster than
+// Pippenger only for small inputs
+static constexpr size_t kStrausMaxPoints = 256;
 
 thread_local BN_CTX_PTR OpensslGroup::ctx_ = BN_CTX_PTR(BN_CTX_new());
 
@@ -29,40 +36,77 @@ thread_local BN_CTX_PTR OpensslGroup::ctx_ = BN_CTX_PTR(BN_CTX_new());
 #define SSL_RET_N(MP_ERR, ...) YACL_ENFORCE_GE((MP_ERR), 0, __VA_ARGS__)
 #define SSL_RET_ZP(MP_ERR, ...) YACL_ENFORCE_GT((MP_ERR), 0, __VA_ARGS__)
 
-BIGNUM_PTR Mp2Bn(const MPInt &mp) {
+namespace {
+
+// Scratch bytes for converting a number of len bytes, on stack for numbers
+// up to 1024 bits and on heap otherwise
+class NumBytes {
+ public:
+  explicit NumBytes(size_t len) : len_(len) {
+    if (len_ > sizeof(stack_)) {
+      heap_.resize(len_);
+    }
+  }
+
+  unsigned char *data() {
+    return len_ > sizeof(stack_) ? heap_.data<unsigned char>() : stack_;
+  }
+  size_t size() const { return len_; }
+
+ private:
+  size_t len_;
+  unsigned char stack_[128];
+  Buffer heap_;
+};
+
+// A copy of the group whose generator is the fixed point, so that the point
+// gets the same precomputed tables as the real generator
+struct OpensslFixedBaseTable final : public FixedBaseTable {
+  int curve_nid;
+  // nullptr iff the point is infinity
+  EC_GROUP_PTR group;
+};
+
+}  // namespace
+
+// Copy the magnitude through little-endian bytes of the actual length, and
+// reuse the memory of bn
+void Mp2Bn(const MPInt &mp, BIGNUM *bn) {
+  CheckNotNull(bn);
   const MPInt *mpp = &mp;
-  MPInt tmp;
+  std::optional<MPInt> tmp;
   if (mp.IsNegative()) {
-    mp.Negate(&tmp);
-    mpp = &tmp;
+    mpp = &tmp.emplace();
+    mp.Negate(&*tmp);
   }
 
-  BIGNUM_PTR res;
-  if (mpp->BitCount() <= sizeof(BN_ULONG) * 8) {
-    res = BIGNUM_PTR(BN_new());
-    SSL_RET_1(BN_set_word(res.get(), mpp->Get<BN_ULONG>()));
+  NumBytes buf((mpp->BitCount() + 7) / 8);
+  if (buf.size() <= sizeof(BN_ULONG)) {
+    SSL_RET_1(BN_set_word(bn, mpp->Get<BN_ULONG>()));
   } else {
-    constexpr int MAX_NUM_BYTE = 1024;
-    unsigned char buf[MAX_NUM_BYTE];
-    YACL_ENFORCE(mpp->BitCount() < MAX_NUM_BYTE,
-                 "Cannot convert mpint [{}], too big", mp.ToString());
-    mpp->ToBytes(buf, MAX_NUM_BYTE, Endian::little);
-    res = BIGNUM_PTR(BN_lebin2bn(buf, MAX_NUM_BYTE, nullptr));
-  }
-
-  if (mpp == &tmp) {  // mpp is negative
-    BN_set_negative(res.get(), true);
+    mpp->ToBytes(buf.data(), buf.size(), Endian::little);
+    YACL_ENFORCE(BN_lebin2bn(buf.data(), buf.size(), bn) != nullptr,
+                 "Cannot convert mpint [{}]", mp.ToString());
   }
+  BN_set_negative(bn, mp.IsNegative());
+}
 
+BIGNUM_PTR Mp2Bn(const MPInt &mp) {
+  auto res = BIGNUM_PTR(BN_new());
+  Mp2Bn(mp, res.get());
   return res;
 }
 
 MPInt Bn2Mp(const BIGNUM *bn) {
   CheckNotNull(bn);
+  NumBytes buf(BN_num_bytes(bn));
+  SSL_RET_N(BN_bn2lebinpad(bn, buf.data(), buf.size()));
+
   MPInt mp;
-  auto *hex_str = BN_bn2hex(bn);
-  ON_SCOPE_EXIT([&] { OPENSSL_free(hex_str); });
-  mp.Set(hex_str, 16);
+  mp.FromMagBytes({buf.data(), buf.size()}, Endian::little);
+  if (BN_is_negative(bn)) {
+    mp.NegateInplace();
+  }
   return mp;
 }
 
@@ -96,33 +140,39 @@ OpensslGroup::OpensslGroup(const CurveMeta &meta, EC_GROUP_PTR group)
     : EcGroupSketch(meta), group_(std::move(group)), field_p_(BN_new()) {
   SSL_RET_1(EC_GROUP_get_curve(group_.get(), field_p_.get(), nullptr, nullptr,
                                ctx_.get()));
+  cofactor_ = Bn2Mp(EC_GROUP_get0_cofactor(group_.get()));
+  field_ = Bn2Mp(field_p_.get());
+  order_ = Bn2Mp(EC_GROUP_get0_order(group_.get()));
+  generator_ = WrapOpensslPoint(
+      EC_POINT_dup(EC_GROUP_get0_generator(group_.get()), group_.get()));
+  has_cofactor_ = BN_is_one(EC_GROUP_get0_cofactor(group_.get())) == 0;
+  is_prime_field_ = EC_GROUP_get_field_type(group_.get()) ==
+                    NID_X9_62_prime_field;
   SSL_RET_1(EC_GROUP_precompute_mult(group_.get(), ctx_.get()));
+  // The generic methods compute k * G with the same ladder as k * P and only
+  // use the precomputation in EC_POINTs_mul() with several points
+  const auto *method = EC_GROUP_method_of(group_.get());
+  std::vector<const EC_METHOD *> generic_methods = {
+      EC_GFp_simple_method(), EC_GFp_mont_method(), EC_GFp_nist_method()};
+#ifndef OPENSSL_NO_EC2M
+  generic_methods.emplace_back(EC_GF2m_simple_method());
+#endif
+  has_fixed_base_method_ =
+      std::find(generic_methods.begin(), generic_methods.end(), method) ==
+      generic_methods.end();
 }
 
 AnyPointPtr OpensslGroup::MakeOpensslPoint() const {
   return WrapOpensslPoint(EC_POINT_new(group_.get()));
 }
 
-MPInt OpensslGroup::GetCofactor() const {
-  static MPInt cache = Bn2Mp(EC_GROUP_get0_cofactor(group_.get()));
-  return cache;
-}
+const MPInt &OpensslGroup::GetCofactor() const { return cofactor_; }
 
-MPInt OpensslGroup::GetField() const {
-  static MPInt cache = Bn2Mp(field_p_.get());
-  return cache;
-}
+const MPInt &OpensslGroup::GetField() const { return field_; }
 
-MPInt OpensslGroup::GetOrder() const {
-  static MPInt cache = Bn2Mp(EC_GROUP_get0_order(group_.get()));
-  return cache;
-}
+const MPInt &OpensslGroup::GetOrder() const { return order_; }
 
-EcPoint OpensslGroup::GetGenerator() const {
-  static EcPoint cache = WrapOpensslPoint(
-      EC_POINT_dup(EC_GROUP_get0_generator(group_.get()), group_.get()));
-  return cache;
-}
+const EcPoint &OpensslGroup::GetGenerator() const { return generator_; }
 
 std::string OpensslGroup::ToString() { return GetCurveName(); }
 
@@ -150,7 +200,13 @@ void OpensslGroup::DoubleInplace(EcPoint *p) const {
 
 EcPoint OpensslGroup::MulBase(const MPInt &scalar) const {
   auto res = MakeOpensslPoint();
-  auto s = Mp2Bn(scalar);
+  if (scalar.IsZero()) {
+    // MulBase(0_mp) is the common way to get the identity, skip the ladder
+    SSL_RET_1(EC_POINT_set_to_infinity(group_.get(), Cast(res)));
+    return res;
+  }
+  thread_local BIGNUM_PTR s(BN_new());
+  Mp2Bn(scalar, s.get());
   SSL_RET_1(EC_POINTs_mul(group_.get(), Cast(res), s.get(), 0, nullptr, nullptr,
                           ctx_.get()));
   return res;
@@ -158,14 +214,20 @@ EcPoint OpensslGroup::MulBase(const MPInt &scalar) const {
 
 EcPoint OpensslGroup::Mul(const EcPoint &point, const MPInt &scalar) const {
   auto res = MakeOpensslPoint();
-  auto s = Mp2Bn(scalar);
+  thread_local BIGNUM_PTR s(BN_new());
+  Mp2Bn(scalar, s.get());
   SSL_RET_1(EC_POINT_mul(group_.get(), Cast(res), nullptr, Cast(point), s.get(),
                          ctx_.get()));
   return res;
 }
 
 void OpensslGroup::MulInplace(EcPoint *point, const MPInt &scalar) const {
-  auto s = Mp2Bn(scalar);
+  if (scalar.IsZero()) {
+    SSL_RET_1(EC_POINT_set_to_infinity(group_.get(), Cast(point)));
+    return;
+  }
+  thread_local BIGNUM_PTR s(BN_new());
+  Mp2Bn(scalar, s.get());
   SSL_RET_1(EC_POINT_mul(group_.get(), Cast(point), nullptr, Cast(point),
                          s.get(), ctx_.get()));
 }
@@ -173,13 +235,85 @@ void OpensslGroup::MulInplace(EcPoint *point, const MPInt &scalar) const {
 EcPoint OpensslGroup::MulDoubleBase(const MPInt &s1, const MPInt &s2,
                                     const EcPoint &p2) const {
   auto res = MakeOpensslPoint();
-  auto bn1 = Mp2Bn(s1);
-  auto bn2 = Mp2Bn(s2);
+  thread_local BIGNUM_PTR bn1(BN_new());
+  thread_local BIGNUM_PTR bn2(BN_new());
+  Mp2Bn(s1, bn1.get());
+  Mp2Bn(s2, bn2.get());
   SSL_RET_1(EC_POINT_mul(group_.get(), Cast(res), bn1.get(), Cast(p2),
                          bn2.get(), ctx_.get()));
   return res;
 }
 
+EcPoint OpensslGroup::MultiScalarMul(absl::Span<const EcPoint> points,
+                                     absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(points.size() == scalars.size(),
+               "MultiScalarMul: size mismatch, #points={}, #scalars={}",
+               points.size(), scalars.size());
+  if (points.size() > kStrausMaxPoints) {
+    return EcGroupSketch::MultiScalarMul(points, scalars);
+  }
+
+  std::vector<const EC_POINT *> ssl_points;
+  std::vector<BIGNUM_PTR> bns;
+  std::vector<const BIGNUM *> ssl_scalars;
+  ssl_points.reserve(points.size());
+  bns.reserve(scalars.size());
+  ssl_scalars.reserve(scalars.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    ssl_points.emplace_back(Cast(points[i]));
+    ssl_scalars.emplace_back(bns.emplace_back(Mp2Bn(scalars[i])).get());
+  }
+
+  auto res = MakeOpensslPoint();
+  SSL_RET_1(EC_POINTs_mul(group_.get(), Cast(res), nullptr, points.size(),
+                          ssl_points.data(), ssl_scalars.data(), ctx_.get()));
+  return res;
+}
+
+std::shared_ptr<const FixedBaseTable> OpensslGroup::CreateFixedBaseTable(
+    const EcPoint &point, size_t window_bits) const {
+  if (!has_fixed_base_method_) {
+    return EcGroupSketch::CreateFixedBaseTable(point, window_bits);
+  }
+
+  auto table = std::make_shared<OpensslFixedBaseTable>();
+  table->curve_nid = EC_GROUP_get_curve_name(group_.get());
+  if (IsInfinity(point)) {
+    return table;
+  }
+
+  table->group = EC_GROUP_PTR(EC_GROUP_dup(group_.get()));
+  YACL_ENFORCE(table->group != nullptr, "Openssl dup group fail");
+  SSL_RET_1(EC_GROUP_set_generator(
+      table->group.get(), Cast(point), EC_GROUP_get0_order(group_.get()),
+      EC_GROUP_get0_cofactor(group_.get())));
+  SSL_RET_1(EC_GROUP_precompute_mult(table->group.get(), ctx_.get()));
+  return table;
+}
+
+EcPoint OpensslGroup::MulFixedBase(const FixedBaseTable &table,
+                                   const MPInt &scalar) const {
+  const auto *t = dynamic_cast<const OpensslFixedBaseTable *>(&table);
+  if (t == nullptr) {
+    return EcGroupSketch::MulFixedBase(table, scalar);
+  }
+  YACL_ENFORCE(t->curve_nid == EC_GROUP_get_curve_name(group_.get()),
+               "The table is not created on curve {}", GetCurveName());
+
+  auto res = MakeOpensslPoint();
+  if (t->group == nullptr) {
+    SSL_RET_1(EC_POINT_set_to_infinity(group_.get(), Cast(res)));
+    return res;
+  }
+  thread_local BIGNUM_PTR s(BN_new());
+  Mp2Bn(scalar, s.get());
+  // points of the copy are compatible with group_, which has the same curve
+  // and method
+  SSL_RET_1(EC_POINT_mul(t->group.get(), Cast(res), s.get(), nullptr, nullptr,
+                         ctx_.get()));
+  return res;
+}
+
 EcPoint OpensslGroup::Negate(const EcPoint &point) const {
   auto res = WrapOpensslPoint(EC_POINT_dup(Cast(point), group_.get()));
   SSL_RET_1(EC_POINT_invert(group_.get(), Cast(res), ctx_.get()));
@@ -195,8 +329,8 @@ AffinePoint OpensslGroup::GetAffinePoint(const EcPoint &point) const {
     return {};
   }
 
-  auto x = BIGNUM_PTR(BN_new());
-  auto y = BIGNUM_PTR(BN_new());
+  thread_local BIGNUM_PTR x(BN_new());
+  thread_local BIGNUM_PTR y(BN_new());
   SSL_RET_1(EC_POINT_get_affine_coordinates(group_.get(), Cast(point), x.get(),
                                             y.get(), ctx_.get()));
   return {Bn2Mp(x.get()), Bn2Mp(y.get())};
@@ -244,6 +378,173 @@ void OpensslGroup::SerializePoint(const EcPoint &point, PointOctetFormat format,
   SSL_RET_ZP(len, "serialize point to buf fail, openssl returns 0");
 }
 
+namespace {
+
+// Same encoding as EC_POINT_point2oct
+void EncodeAffinePoint(const BIGNUM *x, const BIGNUM *y, size_t field_len,
+                       PointOctetFormat format, Buffer *buf) {
+  uint8_t form;
+  size_t len;
+  switch (format) {
+    case PointOctetFormat::X962Uncompressed:
+      form = POINT_CONVERSION_UNCOMPRESSED;
+      len = 1 + 2 * field_len;
+      break;
+    case PointOctetFormat::X962Hybrid:
+      form = POINT_CONVERSION_HYBRID + BN_is_odd(y);
+      len = 1 + 2 * field_len;
+      break;
+    default:
+      form = POINT_CONVERSION_COMPRESSED + BN_is_odd(y);
+      len = 1 + field_len;
+      break;
+  }
+
+  buf->resize(len);
+  auto *p = buf->data<unsigned char>();
+  p[0] = form;
+  SSL_RET_ZP(BN_bn2binpad(x, p + 1, field_len));
+  if (len > 1 + field_len) {
+    SSL_RET_ZP(BN_bn2binpad(y, p + 1 + field_len, field_len));
+  }
+}
+
+}  // namespace
+
+bool OpensslGroup::IsAffine(const EC_POINT *point) const {
+  thread_local BIGNUM_PTR z(BN_new());
+  SSL_RET_1(EC_POINT_get_Jprojective_coordinates_GFp(
+      group_.get(), point, nullptr, nullptr, z.get(), ctx_.get()));
+  return BN_is_one(z.get());
+}
+
+std::vector<const EC_POINT *> OpensslGroup::NormalizedPoints(
+    absl::Span<const EcPoint> points,
+    std::vector<EC_POINT_PTR> *copies) const {
+  std::vector<const EC_POINT *> res(points.size(), nullptr);
+  std::vector<EC_POINT *> to_normalize;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (IsInfinity(points[i])) {
+      continue;
+    }
+    res[i] = Cast(points[i]);
+    if (IsAffine(res[i])) {
+      continue;
+    }
+    // do not touch the caller's point, it may be shared with other threads
+    copies->emplace_back(EC_POINT_dup(res[i], group_.get()));
+    YACL_ENFORCE(copies->back() != nullptr, "openssl: copy point fail");
+    res[i] = copies->back().get();
+    to_normalize.push_back(copies->back().get());
+  }
+
+  if (!to_normalize.empty()) {
+    SSL_RET_1(EC_POINTs_make_affine(group_.get(), to_normalize.size(),
+                                    to_normalize.data(), ctx_.get()));
+  }
+  return res;
+}
+
+void OpensslGroup::GetNormalizedCoordinates(const EC_POINT *point, BIGNUM *x,
+                                            BIGNUM *y) const {
+  SSL_RET_1(EC_POINT_get_Jprojective_coordinates_GFp(group_.get(), point, x, y,
+                                                     nullptr, ctx_.get()));
+}
+
+void OpensslGroup::BatchNormalize(absl::Span<EcPoint> points) const {
+  if (!is_prime_field_) {
+    return;
+  }
+
+  std::vector<EC_POINT *> to_normalize;
+  for (auto &point : points) {
+    if (!IsInfinity(point) && !IsAffine(Cast(point))) {
+      to_normalize.push_back(Cast(&point));
+    }
+  }
+
+  if (!to_normalize.empty()) {
+    SSL_RET_1(EC_POINTs_make_affine(group_.get(), to_normalize.size(),
+                                    to_normalize.data(), ctx_.get()));
+  }
+}
+
+std::vector<Buffer> OpensslGroup::SerializePoints(
+    absl::Span<const EcPoint> points, PointOctetFormat format) const {
+  if (!is_prime_field_) {
+    return EcGroupSketch::SerializePoints(points, format);
+  }
+
+  std::vector<EC_POINT_PTR> copies;
+  auto normalized = NormalizedPoints(points, &copies);
+  size_t field_len = BN_num_bytes(field_p_.get());
+  auto x = BIGNUM_PTR(BN_new());
+  auto y = BIGNUM_PTR(BN_new());
+
+  std::vector<Buffer> res(points.size());
+  for (size_t i = 0; i < normalized.size(); ++i) {
+    if (normalized[i] == nullptr) {
+      // the same as EC_POINT_point2oct
+      res[i].resize(1);
+      res[i].data<uint8_t>()[0] = 0;
+      continue;
+    }
+    GetNormalizedCoordinates(normalized[i], x.get(), y.get());
+    EncodeAffinePoint(x.get(), y.get(), field_len, format, &res[i]);
+  }
+  return res;
+}
+
+void OpensslGroup::StorePoints(absl::Span<const EcPoint> points,
+                               EcPointArray *array, size_t offset) const {
+  if (!is_prime_field_) {
+    EcGroupSketch::StorePoints(points, array, offset);
+    return;
+  }
+
+  std::vector<EC_POINT_PTR> copies;
+  auto normalized = NormalizedPoints(points, &copies);
+  size_t field_bytes = array->FieldBytes();
+  thread_local BIGNUM_PTR x(BN_new());
+  thread_local BIGNUM_PTR y(BN_new());
+  for (size_t i = 0; i < normalized.size(); ++i) {
+    auto slot = (*array)[offset + i];
+    if (normalized[i] == nullptr) {
+      std::memset(slot.data(), 0, slot.size());
+      continue;
+    }
+    GetNormalizedCoordinates(normalized[i], x.get(), y.get());
+    slot[0] = POINT_CONVERSION_UNCOMPRESSED;
+    SSL_RET_ZP(BN_bn2binpad(x.get(), slot.data() + 1, field_bytes));
+    SSL_RET_ZP(
+        BN_bn2binpad(y.get(), slot.data() + 1 + field_bytes, field_bytes));
+  }
+}
+
+void OpensslGroup::LoadPoint(const EcPointArray &array, size_t idx,
+                             EcPoint *point) const {
+  if (!std::holds_alternative<AnyPointPtr>(*point)) {
+    *point = MakeOpensslPoint();
+  }
+
+  auto slot = array[idx];
+  if (slot[0] == 0) {
+    SSL_RET_1(EC_POINT_set_to_infinity(group_.get(), Cast(point)));
+    return;
+  }
+  YACL_ENFORCE(slot[0] == POINT_CONVERSION_UNCOMPRESSED,
+               "Bad EcPointArray slot, prefix={}", slot[0]);
+  size_t field_bytes = array.FieldBytes();
+  thread_local BIGNUM_PTR x(BN_new());
+  thread_local BIGNUM_PTR y(BN_new());
+  YACL_ENFORCE(BN_bin2bn(slot.data() + 1, field_bytes, x.get()) != nullptr);
+  YACL_ENFORCE(BN_bin2bn(slot.data() + 1 + field_bytes, field_bytes,
+                         y.get()) != nullptr);
+  // also checks that the point is on the curve
+  SSL_RET_1(EC_POINT_set_affine_coordinates(group_.get(), Cast(point), x.get(),
+                                            y.get(), ctx_.get()));
+}
+
 EcPoint OpensslGroup::DeserializePoint(ByteContainerView buf,
                                        PointOctetFormat format) const {
   auto p = MakeOpensslPoint();
@@ -317,7 +618,8 @@ size_t HashBn(const BIGNUM *bn) {
 }
 }  // namespace
 
-// Hash point under projective coordinate is very slow. How to improve?
+// Hash point under projective coordinate is very slow, use HashPoints() to
+// share the field inversion over many points.
 size_t OpensslGroup::HashPoint(const EcPoint &point) const {
   if (IsInfinity(point)) {
     return 0;
@@ -335,6 +637,27 @@ size_t OpensslGroup::HashPoint(const EcPoint &point) const {
   return HashBn(x.get()) + BN_is_odd(y.get());
 }
 
+std::vector<size_t> OpensslGroup::HashPoints(
+    absl::Span<const EcPoint> points) const {
+  if (!is_prime_field_) {
+    return EcGroupSketch::HashPoints(points);
+  }
+
+  std::vector<EC_POINT_PTR> copies;
+  auto normalized = NormalizedPoints(points, &copies);
+  auto x = BIGNUM_PTR(BN_new());
+  auto y = BIGNUM_PTR(BN_new());
+
+  std::vector<size_t> res(points.size(), 0);
+  for (size_t i = 0; i < normalized.size(); ++i) {
+    if (normalized[i] != nullptr) {
+      GetNormalizedCoordinates(normalized[i], x.get(), y.get());
+      res[i] = HashBn(x.get()) + BN_is_odd(y.get());
+    }
+  }
+  return res;
+}
+
 bool OpensslGroup::PointEqual(const EcPoint &p1, const EcPoint &p2) const {
   auto res = EC_POINT_cmp(group_.get(), Cast(p1), Cast(p2), ctx_.get());
   SSL_RET_N(res);
@@ -342,9 +665,40 @@ bool OpensslGroup::PointEqual(const EcPoint &p1, const EcPoint &p2) const {
 }
 
 bool OpensslGroup::IsInCurveGroup(const EcPoint &point) const {
+  return IsOnCurve(point) && (!has_cofactor_ || IsInPrimeSubgroup(point));
+}
+
+bool OpensslGroup::IsInCurveGroup(absl::Span<const EcPoint> points) const {
+  // On-curve checks work in Jacobian coordinates and need no inversion, so
+  // they are simply looped over. The costly subgroup checks (only for curves
+  // with cofactor) run after all points passed the cheap ones.
+  for (const auto &point : points) {
+    if (!IsOnCurve(point)) {
+      return false;
+    }
+  }
+  if (!has_cofactor_) {
+    return true;
+  }
+  return std::all_of(points.begin(), points.end(), [this](const EcPoint &p) {
+    return IsInPrimeSubgroup(p);
+  });
+}
+
+bool OpensslGroup::IsOnCurve(const EcPoint &point) const {
+  if (IsInfinity(point)) {
+    return true;
+  }
   auto ret = EC_POINT_is_on_curve(group_.get(), Cast(point), ctx_.get());
   SSL_RET_N(ret, "calc point is on curve fail, err={}", ret);
-  return ret == 1 || IsInfinity(point);
+  return ret == 1;
+}
+
+bool OpensslGroup::IsInPrimeSubgroup(const EcPoint &point) const {
+  auto res = MakeOpensslPoint();
+  SSL_RET_1(EC_POINT_mul(group_.get(), Cast(res), nullptr, Cast(point),
+                         EC_GROUP_get0_order(group_.get()), ctx_.get()));
+  return IsInfinity(res);
 }
 
 bool OpensslGroup::IsInfinity(const EcPoint &point) const {
@@ -29,6 +29,7 @@ namespace yacl::crypto::openssl {
   using TYPE##_PTR = std::unique_ptr<TYPE, TYPE##_DELETER>;
 
 INTERNAL_WRAP_SSL_ECC_TYPE(EC_GROUP, EC_GROUP_free)
+INTERNAL_WRAP_SSL_ECC_TYPE(EC_POINT, EC_POINT_free)
 INTERNAL_WRAP_SSL_ECC_TYPE(BN_CTX, BN_CTX_free)
 INTERNAL_WRAP_SSL_ECC_TYPE(BIGNUM, BN_free)
 
@@ -39,10 +40,10 @@ class OpensslGroup : public EcGroupSketch {
 
   std::string GetLibraryName() const override;
 
-  MPInt GetCofactor() const override;
-  MPInt GetField() const override;
-  MPInt GetOrder() const override;
-  EcPoint GetGenerator() const override;
+  const MPInt& GetCofactor() const override;
+  const MPInt& GetField() const override;
+  const MPInt& GetOrder() const override;
+  const EcPoint& GetGenerator() const override;
   std::string ToString() override;
 
   EcPoint Add(const EcPoint& p1, const EcPoint& p2) const override;
@@ -56,6 +57,18 @@ class OpensslGroup : public EcGroupSketch {
   void MulInplace(EcPoint* point, const MPInt& scalar) const override;
   EcPoint MulDoubleBase(const MPInt& s1, const MPInt& s2,
                         const EcPoint& p2) const override;
+  EcPoint MultiScalarMul(absl::Span<const EcPoint> points,
+                         absl::Span<const MPInt> scalars) const override;
+  using EcGroupSketch::CreateFixedBaseTable;
+  // On curves with a dedicated method (e.g. nistz256 for P-256), the point
+  // gets the same tables as G by EC_GROUP_precompute_mult(), which picks its
+  // own window size, so window_bits is ignored. Such tables are much faster
+  // but also much slower to build (~40ms on P-256) than the generic ones,
+  // which are used on the other curves.
+  std::shared_ptr<const FixedBaseTable> CreateFixedBaseTable(
+      const EcPoint& point, size_t window_bits) const override;
+  EcPoint MulFixedBase(const FixedBaseTable& table,
+                       const MPInt& scalar) const override;
 
   EcPoint Negate(const EcPoint& point) const override;
   void NegateInplace(EcPoint* point) const override;
@@ -69,6 +82,9 @@ class OpensslGroup : public EcGroupSketch {
                         PointOctetFormat format) const override;
   void SerializePoint(const EcPoint& point, PointOctetFormat format,
                       Buffer* buf) const override;
+  using EcGroupSketch::SerializePoints;
+  std::vector<Buffer> SerializePoints(absl::Span<const EcPoint> points,
+                                      PointOctetFormat format) const override;
   EcPoint DeserializePoint(ByteContainerView buf,
                            PointOctetFormat format) const override;
 
@@ -76,17 +92,56 @@ class OpensslGroup : public EcGroupSketch {
                       std::string_view str) const override;
 
   size_t HashPoint(const EcPoint& point) const override;
+  std::vector<size_t> HashPoints(
+      absl::Span<const EcPoint> points) const override;
+  // EC_POINTs_make_affine, one field inversion for the whole batch
+  void BatchNormalize(absl::Span<EcPoint> points) const override;
   bool PointEqual(const EcPoint& p1, const EcPoint& p2) const override;
   bool IsInCurveGroup(const EcPoint& point) const override;
+  bool IsInCurveGroup(absl::Span<const EcPoint> points) const override;
   bool IsInfinity(const EcPoint& point) const override;
 
+ protected:
+  // Normalize each block of points at once and skip BIGNUM <-> MPInt
+  void StorePoints(absl::Span<const EcPoint> points, EcPointArray* array,
+                   size_t offset) const override;
+  void LoadPoint(const EcPointArray& array, size_t idx,
+                 EcPoint* point) const override;
+
  private:
   explicit OpensslGroup(const CurveMeta& meta, EC_GROUP_PTR group);
 
   AnyPointPtr MakeOpensslPoint() const;
+  // On-curve check only, subgroup is checked by callers
+  bool IsOnCurve(const EcPoint& point) const;
+  // Whether order * point is infinity
+  bool IsInPrimeSubgroup(const EcPoint& point) const;
+  // Whether the Jacobian Z of a finite point is 1, prime field only
+  bool IsAffine(const EC_POINT* point) const;
+  // Get the affine form of each point, nullptr for infinity. Points which are
+  // not affine yet are copied to *copies and converted in one batch.
+  std::vector<const EC_POINT*> NormalizedPoints(
+      absl::Span<const EcPoint> points,
+      std::vector<EC_POINT_PTR>* copies) const;
+  // Read (x, y) of a point whose Z is 1, skipping the field inversion which
+  // EC_POINT_get_affine_coordinates always pays on some curves (e.g. nistz256)
+  void GetNormalizedCoordinates(const EC_POINT* point, BIGNUM* x,
+                                BIGNUM* y) const;
 
   EC_GROUP_PTR group_;
   BIGNUM_PTR field_p_;
+  // Curve parameters in yacl types, computed once in the constructor
+  MPInt cofactor_;
+  MPInt field_;
+  MPInt order_;
+  EcPoint generator_;
+  // Points on the curve are in the prime-order subgroup iff cofactor is 1
+  bool has_cofactor_;
+  // Binary curves are always affine in openssl, so the batched
+  // serialize/hash are only needed over prime fields
+  bool is_prime_field_;
+  // Whether openssl has a faster method for k * G than for k * P
+  bool has_fixed_base_method_;
   static thread_local BN_CTX_PTR ctx_;
 };
 
@@ -20,6 +20,7 @@ namespace yacl::crypto::openssl {
 // We only need to test these two functions, other functions will be tested by
 // SPI
 BIGNUM_PTR Mp2Bn(const MPInt &mp);
+void Mp2Bn(const MPInt &mp, BIGNUM *bn);
 MPInt Bn2Mp(const BIGNUM *bn);
 }  // namespace yacl::crypto::openssl
 
@@ -55,6 +56,21 @@ TEST(OpensslTest, BnWorks) {
     ASSERT_EQ(out, in);
   }
 
+  // reuse one BIGNUM, sizes cross the stack buffer and the word boundaries
+  auto bn = BIGNUM_PTR(BN_new());
+  for (int bits : {2048, 3, 64, 65, 1024, 1025, 0, 700}) {
+    for (bool neg : {false, true}) {
+      MPInt in;
+      MPInt::RandomExactBits(bits, &in);
+      if (neg) {
+        in.NegateInplace();
+      }
+      Mp2Bn(in, bn.get());
+      ASSERT_EQ(BN_num_bits(bn.get()), in.BitCount()) << bits;
+      ASSERT_EQ(Bn2Mp(bn.get()), in) << bits;
+    }
+  }
+
   auto tmp = OpensslGroup::Create(GetCurveMetaByName("prime256v1"));
   auto *curve = dynamic_cast<OpensslGroup *>(tmp.get());
   auto p = curve->MulBase(333_mp);
@@ -93,4 +109,71 @@ TEST(OpensslTest, AddInplaceWorks) {
   ASSERT_TRUE(curve->PointEqual(p1, curve->MulBase(3000_mp)));
 }
 
+TEST(OpensslTest, MultiCurveWorks) {
+  // curve parameters are per instance, interleave the curves on purpose
+  std::vector<std::unique_ptr<EcGroup>> curves;
+  std::vector<std::unique_ptr<EcGroup>> refs;
+  for (int round = 0; round < 2; ++round) {
+    for (const auto *name : {"sm2", "secp256k1"}) {
+      curves.emplace_back(OpensslGroup::Create(GetCurveMetaByName(name)));
+      refs.emplace_back(EcGroupFactory::Create(name, "toy"));
+    }
+  }
+
+  for (size_t i = 0; i < curves.size(); ++i) {
+    const auto &curve = curves[i];
+    const auto &ref = refs[i];
+    EXPECT_EQ(curve->GetCofactor(), ref->GetCofactor());
+    EXPECT_EQ(curve->GetField(), ref->GetField());
+    EXPECT_EQ(curve->GetOrder(), ref->GetOrder());
+    EXPECT_EQ(curve->GetAffinePoint(curve->GetGenerator()),
+              ref->GetAffinePoint(ref->GetGenerator()));
+    // returned by reference, no copy
+    EXPECT_EQ(&curve->GetOrder(), &curve->GetOrder());
+    EXPECT_TRUE(curve->IsInfinity(curve->MulBase(curve->GetOrder())));
+    EXPECT_TRUE(curve->PointEqual(curve->Mul(curve->GetGenerator(), 7_mp),
+                                  curve->MulBase(7_mp)));
+  }
+
+  auto p256 = OpensslGroup::Create(GetCurveMetaByName("prime256v1"));
+  EXPECT_EQ(
+      p256->GetOrder(),
+      "0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551"_mp);
+  EXPECT_EQ(
+      p256->GetField(),
+      "0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"_mp);
+  EXPECT_EQ(p256->GetCofactor(), 1_mp);
+}
+
+TEST(OpensslTest, FixedBaseWorks) {
+  // openssl has its own tables for prime256v1 (nistz256), sm2 uses the
+  // generic ones
+  for (const auto *name : {"prime256v1", "sm2"}) {
+    auto curve = OpensslGroup::Create(GetCurveMetaByName(name));
+    auto p = curve->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2, "abc");
+    auto table = curve->CreateFixedBaseTable(p);
+    // tables can be shared by group instances
+    auto curve2 = OpensslGroup::Create(GetCurveMetaByName(name));
+    auto big = "0x123456789abcdef123456789abcdef"_mp;
+    for (const auto &s :
+         {0_mp, 3_mp, -3_mp, big, -big, curve->GetOrder() + 1_mp}) {
+      auto expected = curve->Mul(p, s);
+      EXPECT_TRUE(curve->PointEqual(curve->MulFixedBase(*table, s), expected))
+          << name;
+      EXPECT_TRUE(curve->PointEqual(curve2->MulFixedBase(*table, s), expected))
+          << name;
+    }
+    // the generator of the group is not changed
+    EXPECT_TRUE(curve->PointEqual(curve->MulBase(1_mp), curve->GetGenerator()));
+  }
+
+  // tables of other curves are rejected
+  auto p256 = OpensslGroup::Create(GetCurveMetaByName("prime256v1"));
+  auto sm2 = OpensslGroup::Create(GetCurveMetaByName("sm2"));
+  auto p256_table = p256->CreateFixedBaseTable(p256->MulBase(5_mp));
+  auto sm2_table = sm2->CreateFixedBaseTable(sm2->MulBase(5_mp));
+  EXPECT_ANY_THROW(sm2->MulFixedBase(*p256_table, 1_mp));
+  EXPECT_ANY_THROW(p256->MulFixedBase(*sm2_table, 1_mp));
+}
+
 }  // namespace yacl::crypto::openssl::test
@@ -19,15 +19,17 @@
 namespace yacl::crypto::toy {
 
 ToyEcGroup::ToyEcGroup(const CurveMeta &curve_meta, CurveParam param)
-    : EcGroupSketch(curve_meta), params_(std::move(param)) {}
+    : EcGroupSketch(curve_meta),
+      params_(std::move(param)),
+      generator_(params_.G) {}
 
 std::string ToyEcGroup::GetLibraryName() const { return kLibName; }
 
-MPInt ToyEcGroup::GetCofactor() const { return params_.h; }
-MPInt ToyEcGroup::GetField() const { return params_.p; }
-MPInt ToyEcGroup::GetOrder() const { return params_.n; }
+const MPInt &ToyEcGroup::GetCofactor() const { return params_.h; }
+const MPInt &ToyEcGroup::GetField() const { return params_.p; }
+const MPInt &ToyEcGroup::GetOrder() const { return params_.n; }
 
-EcPoint ToyEcGroup::GetGenerator() const { return params_.G; }
+const EcPoint &ToyEcGroup::GetGenerator() const { return generator_; }
 
 AffinePoint ToyEcGroup::GetAffinePoint(const EcPoint &point) const {
   return std::get<AffinePoint>(point);
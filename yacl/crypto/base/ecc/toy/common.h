@@ -36,10 +36,10 @@ class ToyEcGroup : public EcGroupSketch {
  public:
   ToyEcGroup(const CurveMeta &curve_meta, CurveParam param);
 
-  MPInt GetCofactor() const override;
-  MPInt GetField() const override;
-  MPInt GetOrder() const override;
-  EcPoint GetGenerator() const override;
+  const MPInt &GetCofactor() const override;
+  const MPInt &GetField() const override;
+  const MPInt &GetOrder() const override;
+  const EcPoint &GetGenerator() const override;
   std::string GetLibraryName() const override;
 
   // Internal functions should not call this function since there is an extra
@@ -50,6 +50,7 @@ class ToyEcGroup : public EcGroupSketch {
 
  protected:
   CurveParam params_;
+  EcPoint generator_;
 };
 
 }  // namespace yacl::crypto::toy
@@ -47,6 +47,7 @@ class ToyXGroup : public ToyEcGroup {
                       std::string_view str) const override;
 
   bool PointEqual(const EcPoint &p1, const EcPoint &p2) const override;
+  using EcGroupSketch::IsInCurveGroup;
   bool IsInCurveGroup(const EcPoint &point) const override;
   bool IsInfinity(const EcPoint &point) const override;
 
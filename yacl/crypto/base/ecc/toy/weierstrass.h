@@ -40,6 +40,7 @@ class ToyWeierstrassGroup : public ToyEcGroup {
   EcPoint HashToCurve(HashToCurveStrategy strategy,
                       std::string_view str) const override;
   bool PointEqual(const EcPoint &p1, const EcPoint &p2) const override;
+  using EcGroupSketch::IsInCurveGroup;
   bool IsInCurveGroup(const EcPoint &point) const override;
   bool IsInfinity(const EcPoint &point) const override;
   bool IsInfinity(const AffinePoint &point) const;
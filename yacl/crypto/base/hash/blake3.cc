@@ -32,6 +32,11 @@ Blake3Hash::Blake3Hash(size_t output_len)
   Init();
 }
 
+Blake3Hash::Blake3Hash(const Blake3Hash& other)
+    : hash_algo_(other.hash_algo_),
+      digest_size_(other.digest_size_),
+      hasher_ctx_(other.hasher_ctx_) {}
+
 void Blake3Hash::Init() { blake3_hasher_init(&hasher_ctx_); }
 
 Blake3Hash::~Blake3Hash() { Init(); }
@@ -52,13 +57,17 @@ Blake3Hash& Blake3Hash::Update(ByteContainerView data) {
 }
 
 std::vector<uint8_t> Blake3Hash::CumulativeHash() const {
+  return CumulativeHash(digest_size_);
+}
+
+std::vector<uint8_t> Blake3Hash::CumulativeHash(size_t output_len) const {
   // Do not finalize the internally stored hash context. Instead, finalize a
   // copy of the current context so that the current context can be updated in
   // future calls to Update.
   blake3_hasher blake3_ctx_snapshot = hasher_ctx_;
 
-  std::vector<uint8_t> digest(digest_size_);
-  blake3_hasher_finalize(&blake3_ctx_snapshot, digest.data(), digest_size_);
+  std::vector<uint8_t> digest(output_len);
+  blake3_hasher_finalize(&blake3_ctx_snapshot, digest.data(), output_len);
 
   return digest;
 }
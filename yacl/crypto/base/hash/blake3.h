@@ -28,6 +28,8 @@ class Blake3Hash : public HashInterface {
  public:
   Blake3Hash();
   explicit Blake3Hash(size_t output_len);
+  // Copy the current hash state, i.e. fork the hash.
+  Blake3Hash(const Blake3Hash& other);
   ~Blake3Hash() override;
 
   // From HashInterface.
@@ -36,6 +38,9 @@ class Blake3Hash : public HashInterface {
   Blake3Hash& Reset() override;
   Blake3Hash& Update(ByteContainerView data) override;
   std::vector<uint8_t> CumulativeHash() const override;
+  // Use blake3 as an XOF: the same as CumulativeHash() but with output_len
+  // bytes of output, where output_len is not limited by BLAKE3_OUT_LEN.
+  std::vector<uint8_t> CumulativeHash(size_t output_len) const;
 
  private:
   const HashAlgorithm hash_algo_;
@@ -105,6 +105,23 @@ TEST(Blake3HashTest, MultipleUpdates) {
             test_data_blake3.result2);
 }
 
+// Verify that a copied hash object continues from the state of the original
+// one, and the two objects are independent afterwards.
+TEST(Blake3HashTest, CopyForksState) {
+  Blake3Hash blake3;
+  std::string vector1_bytes = absl::HexStringToBytes(test_data_blake3.vector1);
+  std::string suffix_bytes = absl::HexStringToBytes(test_data_blake3.suffix);
+
+  blake3.Update(vector1_bytes);
+  Blake3Hash fork(blake3);
+  blake3.Update("garbage");
+
+  std::vector<uint8_t> result = fork.Update(suffix_bytes).CumulativeHash();
+  EXPECT_EQ(absl::BytesToHexString(
+                absl::string_view((const char*)result.data(), result.size())),
+            test_data_blake3.result2);
+}
+
 TEST(Blake3HashTest, CustomOutLength) {
   for (size_t i = 0; i <= (BLAKE3_OUT_LEN + 1); i++) {
     if ((i == 0) || (i > BLAKE3_OUT_LEN)) {
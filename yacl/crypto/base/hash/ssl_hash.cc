@@ -46,6 +46,13 @@ SslHash::SslHash(HashAlgorithm hash_algo)
   Reset();
 }
 
+SslHash::SslHash(const SslHash& other)
+    : hash_algo_(other.hash_algo_),
+      digest_size_(other.digest_size_),
+      context_(CheckNotNull(EVP_MD_CTX_new())) {
+  YACL_ENFORCE_EQ(EVP_MD_CTX_copy_ex(context_, other.context_), 1);
+}
+
 SslHash::~SslHash() { EVP_MD_CTX_free(context_); }
 
 HashAlgorithm SslHash::GetHashAlgorithm() const { return hash_algo_; }
@@ -25,6 +25,9 @@ namespace yacl::crypto {
 class SslHash : public HashInterface {
  public:
   explicit SslHash(HashAlgorithm hash_algo);
+  // Copy the current hash state, i.e. fork the hash. This is useful when many
+  // messages share a common prefix.
+  SslHash(const SslHash& other);
   ~SslHash() override;
 
   // From HashInterface.
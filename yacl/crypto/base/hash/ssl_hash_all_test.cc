@@ -131,4 +131,19 @@ TYPED_TEST(SslHashTest, MultipleUpdates) {
             this->Data().result2);
 }
 
+// Verify that a copied hash object continues from the state of the original
+// one, and the two objects are independent afterwards.
+TYPED_TEST(SslHashTest, CopyForksState) {
+  TypeParam hash;
+  hash.Update(this->Data().vector1);
+  TypeParam fork(hash);
+  hash.Update("garbage");
+
+  std::vector<uint8_t> result =
+      fork.Update(this->Data().suffix).CumulativeHash();
+  EXPECT_EQ(absl::BytesToHexString(
+                absl::string_view((const char*)result.data(), result.size())),
+            this->Data().result2);
+}
+
 }  // namespace yacl::crypto
@@ -457,6 +457,18 @@ void MPInt::Deserialize(yacl::ByteContainerView buffer) {
   mp_ext_deserialize(&n_, buffer.data(), buffer.size());
 }
 
+MPInt &MPInt::FromMagBytes(yacl::ByteContainerView buffer, Endian endian) {
+  mp_ext_from_mag_bytes(&n_, buffer.data(), buffer.size(), endian);
+  return *this;
+}
+
+MPInt &MPInt::FromMagBytes(yacl::ByteContainerView buffer, const MPInt &mod,
+                           Endian endian) {
+  FromMagBytes(buffer, endian);
+  MPINT_ENFORCE_OK(mp_mod(&n_, &mod.n_, &n_));
+  return *this;
+}
+
 yacl::Buffer MPInt::ToBytes(size_t byte_len, Endian endian) const {
   yacl::Buffer buf(byte_len);
   ToBytes(buf.data<unsigned char>(), byte_len, endian);
@@ -170,6 +170,15 @@ class MPInt {
   [[nodiscard]] std::string ToString() const;
   [[nodiscard]] std::string ToHexString() const;
 
+  // Load the magnitude (absolute value) from bytes, the result is always >= 0.
+  // This is the inverse of ToBytes() for non-negative numbers, and is much
+  // faster than parsing a string.
+  MPInt &FromMagBytes(yacl::ByteContainerView buffer,
+                      Endian endian = Endian::native);
+  // Same as above, and then reduce the result into [0, mod)
+  MPInt &FromMagBytes(yacl::ByteContainerView buffer, const MPInt &mod,
+                      Endian endian = Endian::native);
+
   yacl::Buffer ToBytes(size_t byte_len, Endian endian = Endian::native) const;
   void ToBytes(unsigned char *buf, size_t buf_len,
                Endian endian = Endian::native) const;
@@ -271,6 +271,32 @@ TEST_F(MPIntTest, ToBytesWorks) {
   EXPECT_EQ(a.ToBytes(10, Endian::little), a.ToBytes(10, Endian::big));
 }
 
+TEST_F(MPIntTest, FromMagBytesWorks) {
+  MPInt a;
+  uint8_t buf[] = {0x12, 0x34, 0x56};
+  EXPECT_EQ(a.FromMagBytes(buf, Endian::little), MPInt(0x563412));
+  EXPECT_EQ(a.FromMagBytes(buf, Endian::big), MPInt(0x123456));
+  EXPECT_EQ(a.FromMagBytes(buf, 1000_mp, Endian::big), MPInt(0x123456 % 1000));
+  EXPECT_TRUE(a.FromMagBytes(ByteContainerView()).IsZero());
+
+  // leading zeros are ok
+  uint8_t zeros[20] = {0};
+  zeros[0] = 7;
+  EXPECT_EQ(a.FromMagBytes(zeros, Endian::little), 7_mp);
+  EXPECT_TRUE(a.FromMagBytes({zeros + 1, 19}, Endian::big).IsZero());
+
+  // round trip with ToBytes
+  for (size_t bits : {1, 59, 60, 61, 255, 256, 1023}) {
+    MPInt b;
+    MPInt::RandomExactBits(bits, &b);
+    for (auto endian : {Endian::little, Endian::big}) {
+      auto bytes = b.ToBytes((bits + 7) / 8 + 1, endian);
+      EXPECT_EQ(a.FromMagBytes(bytes, endian), b);
+      EXPECT_EQ(a.FromMagBytes(bytes, 12345_mp, endian), b % 12345_mp);
+    }
+  }
+}
+
 TEST_F(MPIntTest, CustomPowWorks) {
   // 3^1234
   MPInt res = MPInt::SlowCustomPow<MPInt>(
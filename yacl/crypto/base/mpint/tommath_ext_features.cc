@@ -342,6 +342,37 @@ void mp_ext_to_bytes(const mp_int &num, unsigned char *buf, int64_t byte_len,
   }
 }
 
+void mp_ext_from_mag_bytes(mp_int *num, const uint8_t *buf, size_t buf_len,
+                           Endian endian) {
+  int total_digits = (buf_len * CHAR_BIT + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT;
+  if (num->alloc < total_digits) {
+    MPINT_ENFORCE_OK(mp_grow(num, total_digits));
+  }
+
+  num->sign = MP_ZPOS;
+  num->used = 0;
+  mp_digit cache = 0;
+  int cache_bits = 0;
+  for (size_t pos = 0; pos < buf_len; ++pos) {
+    // consume bytes from the least significant one
+    uint8_t byte =
+        endian == Endian::little ? buf[pos] : buf[buf_len - 1 - pos];
+    cache |= (static_cast<mp_digit>(byte) << cache_bits);
+    cache_bits += 8;
+
+    if (cache_bits >= MP_DIGIT_BIT) {
+      num->dp[num->used++] = cache & MP_MASK;
+      cache >>= MP_DIGIT_BIT;
+      cache_bits -= MP_DIGIT_BIT;
+    }
+  }
+  if (cache > 0) {
+    num->dp[num->used++] = cache & MP_MASK;
+  }
+  // remove leading zero digits
+  mp_clamp(num);
+}
+
 size_t mp_ext_serialize_size(const mp_int &num) {
   auto bits = mp_ext_count_bits_fast(num);
   return (bits + 7) / 8 + 1;  // we add an extra meta byte
@@ -30,6 +30,11 @@ void mp_ext_rand_bits(mp_int *out, int64_t bits);
 void mp_ext_to_bytes(const mp_int &num, unsigned char *buf, int64_t byte_len,
                      Endian endian = Endian::native);
 
+// Load the magnitude (an unsigned integer) stored in buf, the inverse of
+// mp_ext_to_bytes() for num >= 0
+void mp_ext_from_mag_bytes(mp_int *num, const uint8_t *buf, size_t buf_len,
+                           Endian endian = Endian::native);
+
 // returns the number of bits in an int
 // Faster than tommath's native mp_count_bits() method
 int mp_ext_count_bits_fast(const mp_int &a);
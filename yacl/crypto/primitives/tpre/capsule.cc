@@ -27,7 +27,7 @@ std::pair<Capsule::CapsuleStruct, std::vector<uint8_t>> Capsule::EnCapsulate(
     const std::unique_ptr<EcGroup>& ecc_group,
     const Keys::PublicKey& delegating_public_key) const {
   MPInt zero_bn(0);
-  MPInt order = ecc_group->GetOrder();
+  const MPInt& order = ecc_group->GetOrder();
   MPInt r;
   MPInt::RandomLtN(order, &r);
   MPInt u;
@@ -17,11 +17,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include <bitset>
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 
-#include "yacl/base/dynamic_bitset.h"
 #include "yacl/crypto/base/hash/hash_utils.h"
 #include "yacl/crypto/primitives/tpre/kdf.h"
 
@@ -33,10 +33,12 @@ MPInt CipherHash(ByteContainerView input,
   std::array<unsigned char, 32> hash_value_0 = Sm3(input);
   std::array<unsigned char, 32> hash_value_1 = Sm3(hash_value_0);
 
-  dynamic_bitset<uint8_t> binary;
-  binary.append(hash_value_0.begin(), hash_value_0.end());
-  binary.append(hash_value_1.begin(), hash_value_1.end());
-  MPInt hash_bn(binary.to_string(), 2);
+  // hash_value_0 holds the low-order bytes (little endian)
+  std::array<unsigned char, 64> hash_value;
+  std::copy(hash_value_0.begin(), hash_value_0.end(), hash_value.begin());
+  std::copy(hash_value_1.begin(), hash_value_1.end(), hash_value.begin() + 32);
+  MPInt hash_bn;
+  hash_bn.FromMagBytes(hash_value, Endian::little);
 
   MPInt one_bn(1);
   // h_x = 1 + Bignum(sm3(x)||sm3(sm3(x))) mod n-1
@@ -20,10 +20,10 @@ namespace yacl::crypto {
 
 std::pair<Keys::PublicKey, Keys::PrivateKey> Keys::GenerateKeyPair(
     const std::unique_ptr<EcGroup>& ecc_group) const {
-  EcPoint g = ecc_group->GetGenerator();
+  const EcPoint& g = ecc_group->GetGenerator();
 
   // sample random from ecc group
-  MPInt max = ecc_group->GetOrder();
+  const MPInt& max = ecc_group->GetOrder();
   MPInt x;
   MPInt::RandomLtN(max, &x);
 
@@ -46,10 +46,10 @@ std::vector<Keys::KFrag> Keys::GenerateReKey(
     const PublicKey& pk_A, const PublicKey& pk_B, int N, int t) const {
   MPInt zero_bn(0);
   MPInt one_bn(1);
-  MPInt ecc_group_order = ecc_group->GetOrder();
+  const MPInt& ecc_group_order = ecc_group->GetOrder();
 
   // 1. Select x_A randomly and calculation X_ A=g^{x_A}
-  MPInt max = ecc_group_order;
+  const MPInt& max = ecc_group_order;
   MPInt x_A;
   MPInt::RandomLtN(ecc_group_order, &x_A);
 
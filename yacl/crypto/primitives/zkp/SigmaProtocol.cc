@@ -1,9 +1,65 @@
 #include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
 
-#include "yacl/base/dynamic_bitset.h"
+#include <algorithm>
+
+#include "yacl/utils/parallel.h"
 
 namespace yacl::crypto {
 
+namespace internal {
+
+Transcript CreateSigmaTranscriptPrefix(const EcGroup& group,
+                                       absl::Span<const EcPoint> generators,
+                                       const SigmaMeta& meta,
+                                       HashAlgorithm hash) {
+  Transcript transcript(hash);
+  transcript.Absorb(fmt::format("SigmaProtocol/{}/{}/{}/{}",
+                                static_cast<int>(meta.type), meta.num_witness,
+                                meta.num_generator, meta.num_statement));
+  transcript.AbsorbPoints(group, generators);
+  return transcript;
+}
+
+MPInt GetSigmaChallenge(const Transcript& prefix, const EcGroup& group,
+                        absl::Span<const EcPoint> statement,
+                        absl::Span<const EcPoint> rnd_statement,
+                        ByteContainerView other_info) {
+  // Hash(meta, generators, statement, rnd_statement, other_info), where the
+  // constant meta & generators part is absorbed only once in the prefix.
+  Transcript transcript(prefix);
+  transcript.AbsorbPoints(group, statement);
+  transcript.AbsorbPoints(group, rnd_statement);
+  transcript.Absorb(other_info);
+  return SigmaChallengeFromTranscript(transcript, group.GetOrder());
+}
+
+MPInt SigmaChallengeFromTranscript(const Transcript& transcript,
+                                   const MPInt& order) {
+  return transcript.ChallengeScalar(order);
+}
+
+}  // namespace internal
+
+SigmaProtocol::SigmaProtocol(const std::unique_ptr<EcGroup>& group,
+                             const std::vector<EcPoint>& generator,
+                             SigmaMeta meta, HashAlgorithm hash)
+    : group_ref_(group),
+      generator_ref_(generator),
+      meta_(meta),
+      order_(group_ref_->GetOrder()),
+      hash_(hash),
+      transcript_prefix_(internal::CreateSigmaTranscriptPrefix(
+          *group,
+          absl::MakeConstSpan(generator).subspan(0, meta.num_generator), meta,
+          hash)) {}
+
+void SigmaProtocol::EnablePrecompute(size_t window_bits) {
+  gen_tables_ = PrecomputedGenerators::GetOrCreate(
+      *group_ref_,
+      absl::MakeConstSpan(generator_ref_).subspan(0, meta_.num_generator),
+      window_bits);
+}
+
 SigmaNIBatchProof SigmaProtocol::ProveBatch(
     const std::vector<MPInt>& witness, const std::vector<EcPoint>& statement,
     const std::vector<MPInt>& rnd_witness, ByteContainerView other_info) const {
@@ -11,7 +67,7 @@ SigmaNIBatchProof SigmaProtocol::ProveBatch(
   ret_proof.type = meta_.type;
 
   // compute first message : rnd_statement
-  ret_proof.rnd_statement = ToStatement(rnd_witness);
+  ret_proof.rnd_statement = ToRndStatement(statement, rnd_witness);
 
   // get challenge: Hash(generators, statement ,rnd_statement)
   MPInt challenge =
@@ -26,65 +82,54 @@ SigmaNIBatchProof SigmaProtocol::ProveBatch(
 bool SigmaProtocol::VerifyBatch(const std::vector<EcPoint>& statement,
                                 const SigmaNIBatchProof& proof,
                                 ByteContainerView other_info) const {
+  if (!IsWellFormed(statement, proof) ||
+      !CheckOpenedValues(statement, proof.proof)) {
+    return false;
+  }
   MPInt challenge = GetChallenge(statement, proof.rnd_statement, other_info);
 
-  uint32_t i;
+  // verify: rnd_statement[i] == f(proof)[i] - challenge * statement[i]
+  auto rnd_statement = RecoverRndStatement(statement, proof.proof, challenge);
   bool res = true;
+  for (uint32_t i = 0; i < NumRndStatement(); i++) {
+    res &= group_ref_->PointEqual(rnd_statement[i], proof.rnd_statement[i]);
+  }
+  return res;
+}
 
-  switch (meta_.type) {
-    // verify: rnd_statement[0] + challenge * statement[0] == (generator_ref_[0]
-    // * proof.proof[0]) + ... + (generator_ref_[n] * proof.proof[n])
-    case SigmaType::Dlog:
-    case SigmaType::Pedersen:
-    case SigmaType::Representation: {
-      YACL_ENFORCE((meta_.num_statement == 1) &&
-                   (meta_.num_generator == meta_.num_witness));
-      EcPoint RHS = group_ref_->MulBase(0_mp);
-      for (i = 0; i < meta_.num_witness; i++) {
-        RHS = group_ref_->Add(
-            RHS, group_ref_->Mul(generator_ref_[i], proof.proof[i]));
-      }
-      res &= group_ref_->PointEqual(
-          group_ref_->Add(group_ref_->Mul(statement[0], challenge),
-                          proof.rnd_statement[0]),
-          RHS);
-      break;
-    }
-    // verify: rnd_statement[i] + challenge * statement[i] ==
-    // generator_ref_[i] * proof.proof[i]
-    case SigmaType::SeveralDlog:
-      YACL_ENFORCE((meta_.num_generator == meta_.num_statement) &&
-                   (meta_.num_generator == meta_.num_witness));
-      for (i = 0; i < meta_.num_statement; i++) {
-        res &= group_ref_->PointEqual(
-            group_ref_->Add(proof.rnd_statement[i],
-                            group_ref_->Mul(statement[i], challenge)),
-            group_ref_->Mul(generator_ref_[i], proof.proof[i]));
-      }
-      break;
-
-    // verify: rnd_statement[i] + challenge * statement[i] ==
-    // generator_ref_[i] * proof.proof[0]
-    case SigmaType::DlogEq:
-    case SigmaType::SeveralDlogEq:
-    case SigmaType::DHTripple:
-      YACL_ENFORCE((meta_.num_witness == 1) &&
-                   (meta_.num_statement == meta_.num_generator));
-      for (i = 0; i < meta_.num_statement; i++) {
-        res &= group_ref_->PointEqual(
-            group_ref_->Add(proof.rnd_statement[i],
-                            group_ref_->Mul(statement[i], challenge)),
-            group_ref_->Mul(generator_ref_[i], proof.proof[0]));
-      }
-      break;
+bool SigmaProtocol::VerifyBatchMany(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    const std::vector<ByteContainerView>& other_infos,
+    std::vector<size_t>* invalid_idx) const {
+  YACL_ENFORCE(statements.size() == proofs.size() &&
+                   proofs.size() == other_infos.size(),
+               "size mismatch, #statements={}, #proofs={}, #other_infos={}",
+               statements.size(), proofs.size(), other_infos.size());
+
+  std::vector<MPInt> challenges;
+  challenges.reserve(proofs.size());
+  for (size_t i = 0; i < proofs.size(); i++) {
+    challenges.emplace_back(
+        GetChallenge(statements[i], proofs[i].rnd_statement, other_infos[i]));
+  }
+  return VerifyWithChallenges(statements, proofs, challenges, invalid_idx);
+}
 
-    default:
-      YACL_THROW(
-          "zkp lib only support Dlog, Pedersen, Representation, SeveralDlog, "
-          "DlogEq, SeveralDlogEq, DHTripple, "
-          "SigmaProtocol now.");
+bool SigmaProtocol::VerifyWithChallenges(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    absl::Span<const MPInt> challenges,
+    std::vector<size_t>* invalid_idx) const {
+  if (VerifyBatchCombined(statements, proofs, challenges, 0, proofs.size())) {
+    return true;
   }
-  return res;
+  if (invalid_idx != nullptr) {
+    invalid_idx->clear();
+    LocateInvalidProofs(statements, proofs, challenges, 0, proofs.size(),
+                        invalid_idx);
+  }
+  return false;
 }
 
 SigmaNIShortProof SigmaProtocol::ProveShort(
@@ -92,7 +137,7 @@ SigmaNIShortProof SigmaProtocol::ProveShort(
     const std::vector<MPInt>& rnd_witness, ByteContainerView other_info) const {
   SigmaNIShortProof ret_proof;
   std::vector<EcPoint> rnd_statement;
-  rnd_statement = ToStatement(rnd_witness);
+  rnd_statement = ToRndStatement(statement, rnd_witness);
   ret_proof.type = meta_.type;
 
   // get challenge: Hash(generators, statement ,rnd_statement)
@@ -106,148 +151,592 @@ SigmaNIShortProof SigmaProtocol::ProveShort(
 
 bool SigmaProtocol::VerifyShort(const std::vector<EcPoint>& statement,
                                 const SigmaNIShortProof& proof,
-                                ByteContainerView other_info) {
-  std::vector<EcPoint> rnd_statement;
-  rnd_statement.reserve(meta_.num_statement);
+                                ByteContainerView other_info) const {
+  if (!IsWellFormed(statement, proof) ||
+      !CheckOpenedValues(statement, proof.proof)) {
+    return false;
+  }
+  // compute rnd_statement
+  auto rnd_statement =
+      RecoverRndStatement(statement, proof.proof, proof.challenge);
 
-  EcPoint tmp1 = group_ref_->MulBase(0_mp);
-  EcPoint tmp2 = group_ref_->MulBase(0_mp);
-  uint32_t i;
+  // compute challenge
+  MPInt challenge = GetChallenge(statement, rnd_statement, other_info);
 
-  // compute rnd_statement
+  return (challenge == proof.challenge);
+}
+
+std::vector<SigmaNIBatchProof> SigmaProtocol::ProveBatchMany(
+    absl::Span<const std::vector<MPInt>> witnesses,
+    absl::Span<const std::vector<EcPoint>> statements,
+    absl::Span<const std::vector<MPInt>> rnd_witnesses,
+    absl::Span<const ByteContainerView> other_infos) const {
+  CheckManySizes(witnesses, statements, rnd_witnesses, other_infos.size());
+
+  std::vector<SigmaNIBatchProof> proofs(witnesses.size());
+  yacl::parallel_for(0, witnesses.size(), 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      proofs[i] = ProveBatch(witnesses[i], statements[i], rnd_witnesses[i],
+                             other_infos[i]);
+    }
+  });
+  return proofs;
+}
+
+std::vector<SigmaNIShortProof> SigmaProtocol::ProveShortMany(
+    absl::Span<const std::vector<MPInt>> witnesses,
+    absl::Span<const std::vector<EcPoint>> statements,
+    absl::Span<const std::vector<MPInt>> rnd_witnesses,
+    absl::Span<const ByteContainerView> other_infos) const {
+  CheckManySizes(witnesses, statements, rnd_witnesses, other_infos.size());
+
+  std::vector<SigmaNIShortProof> proofs(witnesses.size());
+  yacl::parallel_for(0, witnesses.size(), 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      proofs[i] = ProveShort(witnesses[i], statements[i], rnd_witnesses[i],
+                             other_infos[i]);
+    }
+  });
+  return proofs;
+}
+
+SigmaNIAggregatedProof SigmaProtocol::ProveAggregated(
+    absl::Span<const std::vector<MPInt>> witnesses,
+    absl::Span<const std::vector<EcPoint>> statements,
+    absl::Span<const std::vector<MPInt>> rnd_witnesses,
+    ByteContainerView other_info) const {
+  const size_t n = witnesses.size();
+  CheckManySizes(witnesses, statements, rnd_witnesses, n);
+  YACL_ENFORCE(n > 0, "nothing to prove");
+
+  std::vector<std::vector<EcPoint>> rnd_statements(n);
+  yacl::parallel_for(0, n, 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      rnd_statements[i] = ToRndStatement(statements[i], rnd_witnesses[i]);
+    }
+  });
+
+  SigmaNIAggregatedProof ret_proof;
+  ret_proof.type = meta_.type;
+  ret_proof.challenge =
+      GetAggregatedChallenge(statements, rnd_statements, other_info);
+  ret_proof.proof.resize(n * meta_.num_witness);
+  yacl::parallel_for(0, n, 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      auto proof = ToProof(witnesses[i], rnd_witnesses[i], ret_proof.challenge);
+      std::move(proof.begin(), proof.end(),
+                ret_proof.proof.begin() + i * meta_.num_witness);
+    }
+  });
+  return ret_proof;
+}
+
+bool SigmaProtocol::VerifyAggregated(
+    absl::Span<const std::vector<EcPoint>> statements,
+    const SigmaNIAggregatedProof& proof, ByteContainerView other_info) const {
+  const size_t n = statements.size();
+  if (n == 0 || proof.type != meta_.type ||
+      proof.proof.size() != n * meta_.num_witness) {
+    return false;
+  }
+  for (const auto& statement : statements) {
+    if (statement.size() != meta_.num_statement) {
+      return false;
+    }
+  }
+
+  std::vector<std::vector<EcPoint>> rnd_statements(n);
+  // std::vector<bool> is not safe for concurrent writes
+  std::vector<uint8_t> opened(n);
+  yacl::parallel_for(0, n, 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      auto first = proof.proof.begin() + i * meta_.num_witness;
+      std::vector<MPInt> responses(first, first + meta_.num_witness);
+      opened[i] = CheckOpenedValues(statements[i], responses);
+      if (opened[i] != 0) {
+        rnd_statements[i] =
+            RecoverRndStatement(statements[i], responses, proof.challenge);
+      }
+    }
+  });
+  if (std::find(opened.begin(), opened.end(), 0) != opened.end()) {
+    return false;
+  }
+  return GetAggregatedChallenge(statements, rnd_statements, other_info) ==
+         proof.challenge;
+}
+
+bool SigmaProtocol::VerifyShortMany(
+    absl::Span<const std::vector<EcPoint>> statements,
+    absl::Span<const SigmaNIShortProof> proofs,
+    absl::Span<const ByteContainerView> other_infos,
+    std::vector<size_t>* invalid_idx) const {
+  YACL_ENFORCE(statements.size() == proofs.size() &&
+                   proofs.size() == other_infos.size(),
+               "size mismatch, #statements={}, #proofs={}, #other_infos={}",
+               statements.size(), proofs.size(), other_infos.size());
+
+  // std::vector<bool> is not safe for concurrent writes
+  std::vector<uint8_t> valid(proofs.size());
+  yacl::parallel_for(0, proofs.size(), 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      valid[i] = VerifyShort(statements[i], proofs[i], other_infos[i]);
+    }
+  });
+
+  if (invalid_idx != nullptr) {
+    invalid_idx->clear();
+  }
+  bool res = true;
+  for (size_t i = 0; i < valid.size(); i++) {
+    if (valid[i] == 0) {
+      res = false;
+      if (invalid_idx == nullptr) {
+        break;
+      }
+      invalid_idx->emplace_back(i);
+    }
+  }
+  return res;
+}
+
+void SigmaProtocol::CheckManySizes(
+    absl::Span<const std::vector<MPInt>> witnesses,
+    absl::Span<const std::vector<EcPoint>> statements,
+    absl::Span<const std::vector<MPInt>> rnd_witnesses,
+    size_t num_other_infos) const {
+  YACL_ENFORCE(witnesses.size() == statements.size() &&
+                   witnesses.size() == rnd_witnesses.size() &&
+                   witnesses.size() == num_other_infos,
+               "size mismatch, #witnesses={}, #statements={}, "
+               "#rnd_witnesses={}, #other_infos={}",
+               witnesses.size(), statements.size(), rnd_witnesses.size(),
+               num_other_infos);
+  for (size_t i = 0; i < witnesses.size(); i++) {
+    YACL_ENFORCE(witnesses[i].size() >= meta_.num_witness &&
+                     rnd_witnesses[i].size() >= meta_.num_witness &&
+                     statements[i].size() >= meta_.num_statement,
+                 "instance {} is too short for the relation", i);
+  }
+}
+
+std::vector<EcPoint> SigmaProtocol::ToStatement(
+    const std::vector<MPInt>& witness) const {
+  std::vector<EcPoint> statement;
+  statement.reserve(meta_.num_statement);
+  // Protocols are classified into the following types based on the one way
+  // homomorphism functions used.
+  uint32_t i;
   switch (meta_.type) {
-    // rnd_statement[0] == (generator_ref_[0] * proof.proof[0])  + ...
-    //  + (generator_ref_[n] * proof.proof[n]) - (challenge *statement[0])
+    // Proof of Knowledge of a Representation: Z_q^m -> H, f(x_1, x_2,...,x_m) =
+    // h_1^{x_1} +... +h_m^{xm}
     case SigmaType::Dlog:
     case SigmaType::Pedersen:
     case SigmaType::Representation:
       YACL_ENFORCE((meta_.num_statement == 1) &&
                    (meta_.num_generator == meta_.num_witness));
-      tmp2 = group_ref_->Mul(statement[0], proof.challenge);
-      for (i = 0; i < meta_.num_witness; i++) {
-        tmp1 = group_ref_->Add(
-            tmp1, group_ref_->Mul(generator_ref_[i], proof.proof[i]));
+      if (gen_tables_ != nullptr) {
+        statement.emplace_back(gen_tables_->MultiScalarMul(
+            *group_ref_,
+            absl::MakeConstSpan(witness).subspan(0, meta_.num_witness)));
+        break;
       }
-      rnd_statement.emplace_back(group_ref_->Sub(tmp1, tmp2));
+      statement.emplace_back(group_ref_->MultiScalarMul(
+          absl::MakeConstSpan(generator_ref_).subspan(0, meta_.num_generator),
+          absl::MakeConstSpan(witness).subspan(0, meta_.num_witness)));
       break;
 
-    // rnd_statement[i] = (generator_ref_[i] * proof.proof[i]) - (challenge *
-    // statement[i])
+    // Proof Knowledge of Several Values: G_i -> H_i, f_i(x_i) = h_i^x_i
     case SigmaType::SeveralDlog:
       YACL_ENFORCE((meta_.num_generator == meta_.num_statement) &&
                    (meta_.num_generator == meta_.num_witness));
-      for (i = 0; i < meta_.num_statement; i++) {
-        tmp1 = group_ref_->Mul(generator_ref_[i], proof.proof[i]);
-        tmp2 = group_ref_->Mul(statement[i], proof.challenge);
-        rnd_statement.emplace_back(group_ref_->Sub(tmp1, tmp2));
+      for (i = 0; i < meta_.num_generator; i++) {
+        statement.emplace_back(MulGenerator(i, witness[i]));
       }
       break;
 
-    // verify: rnd_statement[i] == (generator_ref_[i] * proof.proof[0]) -
-    // (challenge * statement[i])
+    // Proof of Equality of Embedded Values: G -> H_1 \times... H_n \times
+    // f(x) = (h_1^x, h_2^x, ..., h_n^x)
     case SigmaType::DlogEq:
-    case SigmaType::SeveralDlogEq:
     case SigmaType::DHTripple:
+    case SigmaType::SeveralDlogEq:
       YACL_ENFORCE((meta_.num_witness == 1) &&
                    (meta_.num_statement == meta_.num_generator));
-      for (i = 0; i < meta_.num_statement; i++) {
-        tmp1 = group_ref_->Mul(generator_ref_[i], proof.proof[0]);
-        tmp2 = group_ref_->Mul(statement[i], proof.challenge);
-        rnd_statement.emplace_back(group_ref_->Sub(tmp1, tmp2));
+      for (i = 0; i < meta_.num_generator; i++) {
+        statement.emplace_back(MulGenerator(i, witness[0]));
       }
       break;
 
+    // Pedersen commitments to x1, x2 & x3 = x1 * x2:
+    // (h1^x1·h2^r1, h1^x2·h2^r2, h1^x3·h2^r3)
+    case SigmaType::PedersenMult:
+    case SigmaType::PedersenMultOpenOne:
+      YACL_ENFORCE((meta_.num_witness == 5) && (meta_.num_generator == 2) &&
+                   (meta_.num_statement == 3));
+      statement.emplace_back(MulGeneratorsAndPoints({witness[0], witness[1]}));
+      statement.emplace_back(MulGeneratorsAndPoints({witness[2], witness[3]}));
+      statement.emplace_back(MulGeneratorsAndPoints(
+          {witness[0].MulMod(witness[2], order_), witness[4]}));
+      break;
+
+    // (h1^r, h2^m·h3^r, h2^m·h4^s)
+    case SigmaType::ElGamalEnc:
+      YACL_ENFORCE((meta_.num_witness == 3) && (meta_.num_generator == 4) &&
+                   (meta_.num_statement == 3));
+      statement.emplace_back(MulGenerator(0, witness[1]));
+      statement.emplace_back(
+          MulSomeGenerators({1, 2}, {witness[0], witness[1]}));
+      statement.emplace_back(
+          MulSomeGenerators({1, 3}, {witness[0], witness[2]}));
+      break;
+
+    case SigmaType::ElGamalReEnc:
+      YACL_THROW(
+          "the statement of ElGamalReEnc depends on the input ciphertext, use "
+          "ToReEncStatement()");
+
     default:
       YACL_THROW(
           "zkp lib only support Dlog, Pedersen, Representation, SeveralDlog, "
-          "DlogEq, SeveralDlogEq, DHTripple, "
-          "SigmaProtocol now.");
+          "DlogEq, SeveralDlogEq, DHTripple, PedersenMult, "
+          "PedersenMultOpenOne, ElGamalEnc, ElGamalReEnc SigmaProtocol now.");
+  }
+  return statement;
+}
+bool SigmaProtocol::VerifyBatchCombined(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    absl::Span<const MPInt> challenges, size_t begin, size_t end) const {
+  // For every proof and every statement index i, it holds that:
+  //   rnd_statement[i] + challenge * statement[i] - f(proof)[i] == 0
+  // so we check: sum_{proofs, i} weight * (...) == 0, where all generator
+  // terms are merged into one coefficient per generator.
+  std::vector<EcPoint> points;
+  std::vector<MPInt> scalars;
+  points.reserve((end - begin) * meta_.num_statement * 2 +
+                 meta_.num_generator);
+  scalars.reserve(points.capacity());
+  std::vector<MPInt> gen_coeffs(meta_.num_generator, 0_mp);
+
+  for (size_t idx = begin; idx < end; idx++) {
+    const auto& statement = statements[idx];
+    const auto& proof = proofs[idx];
+    if (!IsWellFormed(statement, proof)) {
+      return false;
+    }
+    AppendCheckTerms(statement, proof, challenges[idx], &points, &scalars,
+                     &gen_coeffs);
   }
+  AppendGeneratorTerms(gen_coeffs, &points, &scalars);
+  return group_ref_->IsInfinity(group_ref_->MultiScalarMul(points, scalars));
+}
 
-  // compute challenge
-  MPInt challenge = GetChallenge(statement, rnd_statement, other_info);
+bool SigmaProtocol::IsWellFormed(const std::vector<EcPoint>& statement,
+                                 const SigmaNIBatchProof& proof) const {
+  return proof.type == meta_.type && statement.size() == meta_.num_statement &&
+         proof.rnd_statement.size() == NumRndStatement() &&
+         proof.proof.size() == meta_.num_witness &&
+         group_ref_->IsInCurveGroup(proof.rnd_statement);
+}
 
-  return (challenge == proof.challenge);
+bool SigmaProtocol::IsWellFormed(const std::vector<EcPoint>& statement,
+                                 const SigmaNIShortProof& proof) const {
+  return proof.type == meta_.type && statement.size() == meta_.num_statement &&
+         proof.proof.size() == meta_.num_witness;
 }
 
-std::vector<EcPoint> SigmaProtocol::ToStatement(
-    const std::vector<MPInt>& witness) const {
-  std::vector<EcPoint> statement;
-  statement.reserve(meta_.num_statement);
-  // Protocols are classified into the following types based on the one way
-  // homomorphism functions used.
+void SigmaProtocol::AppendCheckTerms(const std::vector<EcPoint>& statement,
+                                     const SigmaNIBatchProof& proof,
+                                     const MPInt& challenge,
+                                     std::vector<EcPoint>* points,
+                                     std::vector<MPInt>* scalars,
+                                     std::vector<MPInt>* gen_coeffs) const {
+  if (meta_.type == SigmaType::PedersenMult ||
+      meta_.type == SigmaType::PedersenMultOpenOne) {
+    AppendMultCheckTerms(statement, proof, challenge, points, scalars,
+                         gen_coeffs);
+    return;
+  }
+  if (meta_.type == SigmaType::ElGamalReEnc) {
+    // R_i + c·c_i' - c·c_i - h_i^s
+    for (uint32_t i = 0; i < 2; i++) {
+      MPInt weight;
+      MPInt::RandomExactBits(kBatchWeightBits, &weight);
+      MPInt weighted_challenge = weight.MulMod(challenge, order_);
+      points->emplace_back(proof.rnd_statement[i]);
+      scalars->emplace_back(weight);
+      points->emplace_back(statement[i + 2]);
+      scalars->emplace_back(weighted_challenge);
+      points->emplace_back(statement[i]);
+      scalars->emplace_back(order_ - weighted_challenge);
+      (*gen_coeffs)[i] -= weight * proof.proof[0];
+    }
+    return;
+  }
+
+  for (uint32_t i = 0; i < meta_.num_statement; i++) {
+    MPInt weight;
+    MPInt::RandomExactBits(kBatchWeightBits, &weight);
+    points->emplace_back(proof.rnd_statement[i]);
+    scalars->emplace_back(weight);
+    points->emplace_back(statement[i]);
+    scalars->emplace_back(weight.MulMod(challenge, order_));
+
+    switch (meta_.type) {
+      // f(proof)[0] = (generator_ref_[0] * proof[0]) + ... +
+      // (generator_ref_[n] * proof[n])
+      case SigmaType::Dlog:
+      case SigmaType::Pedersen:
+      case SigmaType::Representation:
+        YACL_ENFORCE((meta_.num_statement == 1) &&
+                     (meta_.num_generator == meta_.num_witness));
+        for (uint32_t j = 0; j < meta_.num_generator; j++) {
+          (*gen_coeffs)[j] -= weight * proof.proof[j];
+        }
+        break;
+      // f(proof)[i] = generator_ref_[i] * proof[i]
+      case SigmaType::SeveralDlog:
+        YACL_ENFORCE((meta_.num_generator == meta_.num_statement) &&
+                     (meta_.num_generator == meta_.num_witness));
+        (*gen_coeffs)[i] -= weight * proof.proof[i];
+        break;
+      // f(proof)[i] = generator_ref_[i] * proof[0]
+      case SigmaType::DlogEq:
+      case SigmaType::SeveralDlogEq:
+      case SigmaType::DHTripple:
+        YACL_ENFORCE((meta_.num_witness == 1) &&
+                     (meta_.num_statement == meta_.num_generator));
+        (*gen_coeffs)[i] -= weight * proof.proof[0];
+        break;
+      // f(proof) = (h1^s2, h2^s1·h3^s2, h2^s1·h4^s3)
+      case SigmaType::ElGamalEnc:
+        YACL_ENFORCE((meta_.num_witness == 3) && (meta_.num_generator == 4) &&
+                     (meta_.num_statement == 3));
+        if (i == 0) {
+          (*gen_coeffs)[0] -= weight * proof.proof[1];
+        } else {
+          (*gen_coeffs)[1] -= weight * proof.proof[0];
+          (*gen_coeffs)[i + 1] -= weight * proof.proof[i];
+        }
+        break;
+      default:
+        YACL_THROW(
+            "zkp lib only support Dlog, Pedersen, Representation, "
+            "SeveralDlog, DlogEq, SeveralDlogEq, DHTripple, PedersenMult, "
+            "PedersenMultOpenOne, ElGamalEnc SigmaProtocol now.");
+    }
+  }
+}
+
+void SigmaProtocol::AppendGeneratorTerms(const std::vector<MPInt>& gen_coeffs,
+                                         std::vector<EcPoint>* points,
+                                         std::vector<MPInt>* scalars) const {
+  if (gen_tables_ != nullptr) {
+    points->emplace_back(gen_tables_->MultiScalarMul(*group_ref_, gen_coeffs));
+    scalars->emplace_back(1_mp);
+    return;
+  }
+  for (uint32_t j = 0; j < meta_.num_generator; j++) {
+    points->emplace_back(generator_ref_[j]);
+    scalars->emplace_back(gen_coeffs[j] % order_);
+  }
+}
+
+void SigmaProtocol::LocateInvalidProofs(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    absl::Span<const MPInt> challenges, size_t begin, size_t end,
+    std::vector<size_t>* invalid_idx) const {
+  // The caller has already known that [begin, end) contains invalid proofs
+  if (end - begin == 1) {
+    invalid_idx->emplace_back(begin);
+    return;
+  }
+
+  size_t mid = begin + (end - begin) / 2;
+  for (auto [b, e] : {std::pair{begin, mid}, std::pair{mid, end}}) {
+    if (!VerifyBatchCombined(statements, proofs, challenges, b, e)) {
+      LocateInvalidProofs(statements, proofs, challenges, b, e, invalid_idx);
+    }
+  }
+}
+
+EcPoint SigmaProtocol::MulGenerator(uint32_t idx, const MPInt& scalar) const {
+  if (gen_tables_ != nullptr) {
+    return gen_tables_->Mul(*group_ref_, idx, scalar);
+  }
+  return group_ref_->Mul(generator_ref_[idx], scalar);
+}
+
+EcPoint SigmaProtocol::MulGeneratorAndPoint(uint32_t idx, const MPInt& s1,
+                                            const EcPoint& point,
+                                            const MPInt& s2) const {
+  if (gen_tables_ != nullptr) {
+    return group_ref_->Add(gen_tables_->Mul(*group_ref_, idx, s1),
+                           group_ref_->Mul(point, s2));
+  }
+  return group_ref_->MultiScalarMul({generator_ref_[idx], point}, {s1, s2});
+}
+
+std::vector<EcPoint> SigmaProtocol::RecoverRndStatement(
+    const std::vector<EcPoint>& statement, const std::vector<MPInt>& proof,
+    const MPInt& challenge) const {
+  std::vector<EcPoint> rnd_statement;
+  rnd_statement.reserve(meta_.num_statement);
+  MPInt neg_challenge = -challenge;
   uint32_t i;
+
   switch (meta_.type) {
-    // Proof of Knowledge of a Representation: Z_q^m -> H, f(x_1, x_2,...,x_m) =
-    // h_1^{x_1} +... +h_m^{xm}
+    // rnd_statement[0] = (generator_ref_[0] * proof[0]) + ... +
+    // (generator_ref_[n] * proof[n]) - (challenge * statement[0]),
+    // computed by one multi-scalar multiplication
     case SigmaType::Dlog:
     case SigmaType::Pedersen:
-    case SigmaType::Representation:
+    case SigmaType::Representation: {
       YACL_ENFORCE((meta_.num_statement == 1) &&
                    (meta_.num_generator == meta_.num_witness));
-      statement.emplace_back(group_ref_->Mul(generator_ref_[0], witness[0]));
-      for (i = 1; i < meta_.num_generator; i++) {
-        statement[0] = group_ref_->Add(
-            statement[0], group_ref_->Mul(generator_ref_[i], witness[i]));
+      if (gen_tables_ != nullptr) {
+        rnd_statement.emplace_back(group_ref_->Add(
+            gen_tables_->MultiScalarMul(
+                *group_ref_,
+                absl::MakeConstSpan(proof).subspan(0, meta_.num_witness)),
+            group_ref_->Mul(statement[0], neg_challenge)));
+        break;
       }
+      std::vector<EcPoint> points(
+          generator_ref_.begin(),
+          generator_ref_.begin() + meta_.num_generator);
+      points.emplace_back(statement[0]);
+      std::vector<MPInt> scalars(proof.begin(),
+                                 proof.begin() + meta_.num_witness);
+      scalars.emplace_back(neg_challenge);
+      rnd_statement.emplace_back(group_ref_->MultiScalarMul(points, scalars));
       break;
+    }
 
-    // Proof Knowledge of Several Values: G_i -> H_i, f_i(x_i) = h_i^x_i
+    // rnd_statement[i] = (generator_ref_[i] * proof[i]) - (challenge *
+    // statement[i])
     case SigmaType::SeveralDlog:
       YACL_ENFORCE((meta_.num_generator == meta_.num_statement) &&
                    (meta_.num_generator == meta_.num_witness));
-      for (i = 0; i < meta_.num_generator; i++) {
-        statement.emplace_back(group_ref_->Mul(generator_ref_[i], witness[i]));
+      for (i = 0; i < meta_.num_statement; i++) {
+        rnd_statement.emplace_back(
+            MulGeneratorAndPoint(i, proof[i], statement[i], neg_challenge));
       }
       break;
 
-    // Proof of Equality of Embedded Values: G -> H_1 \times... H_n \times
-    // f(x) = (h_1^x, h_2^x, ..., h_n^x)
+    // rnd_statement[i] = (generator_ref_[i] * proof[0]) - (challenge *
+    // statement[i])
     case SigmaType::DlogEq:
-    case SigmaType::DHTripple:
     case SigmaType::SeveralDlogEq:
+    case SigmaType::DHTripple:
       YACL_ENFORCE((meta_.num_witness == 1) &&
                    (meta_.num_statement == meta_.num_generator));
-      for (i = 0; i < meta_.num_generator; i++) {
-        statement.emplace_back(group_ref_->Mul(generator_ref_[i], witness[0]));
+      for (i = 0; i < meta_.num_statement; i++) {
+        rnd_statement.emplace_back(
+            MulGeneratorAndPoint(i, proof[0], statement[i], neg_challenge));
+      }
+      break;
+
+    // rnd_statement = (h1^s1·h2^s2, h1^s3·h2^s4, z1^s3·h2^s5) - challenge *
+    // statement, each is one multi-scalar multiplication
+    case SigmaType::PedersenMult:
+      YACL_ENFORCE((meta_.num_witness == 5) && (meta_.num_generator == 2) &&
+                   (meta_.num_statement == 3));
+      rnd_statement.emplace_back(MulGeneratorsAndPoints(
+          {proof[0], proof[1]}, {statement[0]}, {neg_challenge}));
+      rnd_statement.emplace_back(MulGeneratorsAndPoints(
+          {proof[2], proof[3]}, {statement[1]}, {neg_challenge}));
+      rnd_statement.emplace_back(
+          MulGeneratorsAndPoints({0_mp, proof[4]}, {statement[0], statement[2]},
+                                 {proof[2], neg_challenge}));
+      break;
+
+    // rnd_statement = (h1^s1·h2^s2 - challenge * z1,
+    //                  h2^s5 - challenge * (z3 - x2 * z1))
+    case SigmaType::PedersenMultOpenOne:
+      YACL_ENFORCE((meta_.num_witness == 5) && (meta_.num_generator == 2) &&
+                   (meta_.num_statement == 3));
+      rnd_statement.emplace_back(MulGeneratorsAndPoints(
+          {proof[0], proof[1]}, {statement[0]}, {neg_challenge}));
+      rnd_statement.emplace_back(MulGeneratorsAndPoints(
+          {0_mp, proof[4]}, {statement[0], statement[2]},
+          {challenge.MulMod(proof[2], order_), neg_challenge}));
+      break;
+
+    // rnd_statement = (h1^s2, h2^s1·h3^s2, h2^s1·h4^s3) - c * statement
+    case SigmaType::ElGamalEnc:
+      YACL_ENFORCE((meta_.num_witness == 3) && (meta_.num_generator == 4) &&
+                   (meta_.num_statement == 3));
+      rnd_statement.emplace_back(
+          MulGeneratorAndPoint(0, proof[1], statement[0], neg_challenge));
+      rnd_statement.emplace_back(MulSomeGenerators(
+          {1, 2}, {proof[0], proof[1]}, {statement[1]}, {neg_challenge}));
+      rnd_statement.emplace_back(MulSomeGenerators(
+          {1, 3}, {proof[0], proof[2]}, {statement[2]}, {neg_challenge}));
+      break;
+
+    // rnd_statement[i] = h_i^s - challenge * (c_i' - c_i)
+    case SigmaType::ElGamalReEnc:
+      YACL_ENFORCE((meta_.num_witness == 1) && (meta_.num_generator == 2) &&
+                   (meta_.num_statement == 4));
+      for (i = 0; i < 2; i++) {
+        rnd_statement.emplace_back(
+            MulSomeGenerators({i}, {proof[0]}, {statement[i + 2], statement[i]},
+                              {neg_challenge, challenge}));
       }
       break;
 
     default:
       YACL_THROW(
           "zkp lib only support Dlog, Pedersen, Representation, SeveralDlog, "
-          "DlogEq, SeveralDlogEq, DHTripple, "
-          "SigmaProtocol now.");
+          "DlogEq, SeveralDlogEq, DHTripple, PedersenMult, "
+          "PedersenMultOpenOne, ElGamalEnc, ElGamalReEnc SigmaProtocol now.");
   }
+  return rnd_statement;
+}
+
+std::vector<EcPoint> SigmaProtocol::ToReEncStatement(const MPInt& r,
+                                                     const EcPoint& c1,
+                                                     const EcPoint& c2) const {
+  YACL_ENFORCE((meta_.type == SigmaType::ElGamalReEnc) &&
+                   (meta_.num_witness == 1) && (meta_.num_generator == 2) &&
+                   (meta_.num_statement == 4),
+               "ToReEncStatement() is only for ElGamalReEnc");
+  std::vector<EcPoint> statement = {c1, c2};
+  statement.emplace_back(
+      MulSomeGenerators({0}, {r}, absl::MakeConstSpan(&c1, 1), {1_mp}));
+  statement.emplace_back(
+      MulSomeGenerators({1}, {r}, absl::MakeConstSpan(&c2, 1), {1_mp}));
   return statement;
 }
+
 MPInt SigmaProtocol::GetChallenge(const std::vector<EcPoint>& statement,
                                   const std::vector<EcPoint>& rnd_statement,
                                   ByteContainerView other_info) const {
-  RandomOracle ro(hash_, 32);
-  std::vector<Buffer> buf_vec;
-  buf_vec.reserve(meta_.num_statement * 2 + meta_.num_generator);
-  uint32_t i;
-
-  for (i = 0; i < meta_.num_generator; i++) {
-    buf_vec.emplace_back(group_ref_->SerializePoint(generator_ref_[i]));
-  }
-
-  for (i = 0; i < meta_.num_statement; i++) {
-    buf_vec.emplace_back(group_ref_->SerializePoint(statement[i]));
-  }
+  return internal::GetSigmaChallenge(
+      transcript_prefix_, *group_ref_,
+      absl::MakeConstSpan(statement).subspan(0, meta_.num_statement),
+      absl::MakeConstSpan(rnd_statement).subspan(0, NumRndStatement()),
+      other_info);
+}
 
-  for (i = 0; i < meta_.num_statement; i++) {
-    buf_vec.emplace_back(group_ref_->SerializePoint(rnd_statement[i]));
+MPInt SigmaProtocol::GetAggregatedChallenge(
+    absl::Span<const std::vector<EcPoint>> statements,
+    const std::vector<std::vector<EcPoint>>& rnd_statements,
+    ByteContainerView other_info) const {
+  Transcript transcript(transcript_prefix_);
+  transcript.Absorb(fmt::format("Aggregated/{}", statements.size()));
+  for (size_t i = 0; i < statements.size(); i++) {
+    transcript.AbsorbPoints(
+        *group_ref_,
+        absl::MakeConstSpan(statements[i]).subspan(0, meta_.num_statement));
+    transcript.AbsorbPoints(
+        *group_ref_,
+        absl::MakeConstSpan(rnd_statements[i]).subspan(0, NumRndStatement()));
   }
-
-  auto out = ro.Gen<std::array<uint8_t, 32>>({*(buf_vec.data()), other_info});
-
-  // TODO: replace this step with BytesToMPInt();
-  dynamic_bitset<uint8_t> binary;
-  binary.append(out.begin(), out.end());
-  MPInt hash_bn(binary.to_string(), 2);
-  return hash_bn;
+  transcript.Absorb(other_info);
+  return internal::SigmaChallengeFromTranscript(transcript, order_);
 }
 
 std::vector<MPInt> SigmaProtocol::ToProof(const std::vector<MPInt>& witness,
@@ -255,10 +744,162 @@ std::vector<MPInt> SigmaProtocol::ToProof(const std::vector<MPInt>& witness,
                                           const MPInt& challenge) const {
   std::vector<MPInt> proof;
   proof.reserve(meta_.num_witness);
+  if (meta_.type == SigmaType::PedersenMult ||
+      meta_.type == SigmaType::PedersenMultOpenOne) {
+    // the transformed witness of z3 = z1^x2·h2^(r3-x2·r1)
+    MPInt r3 = witness[4] - witness[2] * witness[1];
+    for (uint32_t i = 0; i < meta_.num_witness; i++) {
+      const auto& w = (i == 4) ? r3 : witness[i];
+      if (meta_.type == SigmaType::PedersenMultOpenOne && (i == 2 || i == 3)) {
+        // opened in clear
+        proof.emplace_back(w % order_);
+      } else {
+        proof.emplace_back((challenge * w + rnd_witness[i]) % order_);
+      }
+    }
+    return proof;
+  }
   for (uint32_t i = 0; i < meta_.num_witness; i++) {
     proof.emplace_back((challenge * witness[i] + rnd_witness[i]) % order_);
   }
   return proof;
 }
 
+uint32_t SigmaProtocol::NumRndStatement() const {
+  return (meta_.type == SigmaType::PedersenMultOpenOne ||
+          meta_.type == SigmaType::ElGamalReEnc)
+             ? 2
+             : meta_.num_statement;
+}
+
+std::vector<EcPoint> SigmaProtocol::ToRndStatement(
+    const std::vector<EcPoint>& statement,
+    const std::vector<MPInt>& rnd_witness) const {
+  switch (meta_.type) {
+    // (h1^k1·h2^k2, h1^k3·h2^k4, z1^k3·h2^k5)
+    case SigmaType::PedersenMult: {
+      std::vector<EcPoint> rnd_statement;
+      rnd_statement.reserve(3);
+      rnd_statement.emplace_back(
+          MulGeneratorsAndPoints({rnd_witness[0], rnd_witness[1]}));
+      rnd_statement.emplace_back(
+          MulGeneratorsAndPoints({rnd_witness[2], rnd_witness[3]}));
+      rnd_statement.emplace_back(MulGeneratorAndPoint(
+          1, rnd_witness[4], statement[0], rnd_witness[2]));
+      return rnd_statement;
+    }
+    // (h1^k1·h2^k2, h2^k5)
+    case SigmaType::PedersenMultOpenOne: {
+      std::vector<EcPoint> rnd_statement;
+      rnd_statement.reserve(2);
+      rnd_statement.emplace_back(
+          MulGeneratorsAndPoints({rnd_witness[0], rnd_witness[1]}));
+      rnd_statement.emplace_back(MulGenerator(1, rnd_witness[4]));
+      return rnd_statement;
+    }
+    // (h1^k, h2^k)
+    case SigmaType::ElGamalReEnc:
+      return {MulGenerator(0, rnd_witness[0]), MulGenerator(1, rnd_witness[0])};
+    default:
+      return ToStatement(rnd_witness);
+  }
+}
+
+EcPoint SigmaProtocol::MulGeneratorsAndPoints(
+    absl::Span<const MPInt> gen_scalars, absl::Span<const EcPoint> points,
+    absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(gen_scalars.size() <= meta_.num_generator);
+  if (gen_tables_ != nullptr) {
+    auto res = gen_tables_->MultiScalarMul(*group_ref_, gen_scalars);
+    if (points.empty()) {
+      return res;
+    }
+    return group_ref_->Add(res, group_ref_->MultiScalarMul(points, scalars));
+  }
+  std::vector<EcPoint> all_points(
+      generator_ref_.begin(), generator_ref_.begin() + gen_scalars.size());
+  all_points.insert(all_points.end(), points.begin(), points.end());
+  std::vector<MPInt> all_scalars(gen_scalars.begin(), gen_scalars.end());
+  all_scalars.insert(all_scalars.end(), scalars.begin(), scalars.end());
+  return group_ref_->MultiScalarMul(all_points, all_scalars);
+}
+
+EcPoint SigmaProtocol::MulSomeGenerators(
+    absl::Span<const uint32_t> gen_idx, absl::Span<const MPInt> gen_scalars,
+    absl::Span<const EcPoint> points, absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(gen_idx.size() == gen_scalars.size() &&
+               points.size() == scalars.size());
+  if (gen_tables_ != nullptr) {
+    std::vector<MPInt> all_gen_scalars(meta_.num_generator, 0_mp);
+    for (size_t i = 0; i < gen_idx.size(); i++) {
+      all_gen_scalars[gen_idx[i]] = gen_scalars[i];
+    }
+    return MulGeneratorsAndPoints(all_gen_scalars, points, scalars);
+  }
+  std::vector<EcPoint> all_points;
+  std::vector<MPInt> all_scalars(gen_scalars.begin(), gen_scalars.end());
+  all_points.reserve(gen_idx.size() + points.size());
+  for (auto idx : gen_idx) {
+    all_points.emplace_back(generator_ref_[idx]);
+  }
+  all_points.insert(all_points.end(), points.begin(), points.end());
+  all_scalars.insert(all_scalars.end(), scalars.begin(), scalars.end());
+  return group_ref_->MultiScalarMul(all_points, all_scalars);
+}
+
+bool SigmaProtocol::CheckOpenedValues(const std::vector<EcPoint>& statement,
+                                      const std::vector<MPInt>& proof) const {
+  if (meta_.type != SigmaType::PedersenMultOpenOne) {
+    return true;
+  }
+  return group_ref_->PointEqual(MulGeneratorsAndPoints({proof[2], proof[3]}),
+                                statement[1]);
+}
+
+void SigmaProtocol::AppendMultCheckTerms(const std::vector<EcPoint>& statement,
+                                         const SigmaNIBatchProof& proof,
+                                         const MPInt& challenge,
+                                         std::vector<EcPoint>* points,
+                                         std::vector<MPInt>* scalars,
+                                         std::vector<MPInt>* gen_coeffs) const {
+  // Same as VerifyBatchCombined(), every equation below is "== 0" and is
+  // multiplied by an independent random weight.
+  const auto& s = proof.proof;
+  const auto& rnd = proof.rnd_statement;
+  std::array<MPInt, 3> w;
+  for (auto& weight : w) {
+    MPInt::RandomExactBits(kBatchWeightBits, &weight);
+  }
+  auto add_point = [&](const EcPoint& point, const MPInt& scalar) {
+    points->emplace_back(point);
+    scalars->emplace_back(scalar % order_);
+  };
+
+  if (meta_.type == SigmaType::PedersenMult) {
+    // R1 + c·z1 - h1^s1·h2^s2
+    // R2 + c·z2 - h1^s3·h2^s4
+    // R3 + c·z3 - z1^s3·h2^s5
+    add_point(rnd[0], w[0]);
+    add_point(rnd[1], w[1]);
+    add_point(rnd[2], w[2]);
+    add_point(statement[0], w[0] * challenge - w[2] * s[2]);
+    add_point(statement[1], w[1] * challenge);
+    add_point(statement[2], w[2] * challenge);
+    (*gen_coeffs)[0] -= w[0] * s[0] + w[1] * s[2];
+    (*gen_coeffs)[1] -= w[0] * s[1] + w[1] * s[3] + w[2] * s[4];
+    return;
+  }
+
+  // R1 + c·z1 - h1^s1·h2^s2
+  // R3 + c·z3 - c·x2·z1 - h2^s5
+  // h1^x2·h2^r2 - z2
+  add_point(rnd[0], w[0]);
+  add_point(rnd[1], w[1]);
+  add_point(statement[0], (w[0] - w[1] * s[2]) * challenge);
+  add_point(statement[1], -w[2]);
+  add_point(statement[2], w[1] * challenge);
+  (*gen_coeffs)[0] += w[2] * s[2] - w[0] * s[0];
+  (*gen_coeffs)[1] += w[2] * s[3] - w[0] * s[1] - w[1] * s[4];
+}
+
 }  // namespace yacl::crypto
\ No newline at end of file
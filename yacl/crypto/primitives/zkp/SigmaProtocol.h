@@ -6,7 +6,8 @@
 #include "yacl/crypto/base/ecc/ec_point.h"
 #include "yacl/crypto/base/ecc/openssl/openssl_group.h"
 #include "yacl/crypto/base/hash/ssl_hash.h"
-#include "yacl/crypto/tools/random_oracle.h"
+#include "yacl/crypto/primitives/zkp/precomputed_generators.h"
+#include "yacl/crypto/primitives/zkp/transcript.h"
 
 // This resource implements an improved SigmaProtocol():
 // let n be a positive integer and let i \in [1,n].
@@ -14,7 +15,8 @@
 // of knowledge of a vector witness = {[x_i]}_{i \in[1,n]} such that
 // Z_i = [x_i] , where [x_i] = OneWayHomomorphismFun(x).
 // Now this lib only implements: Dlog, Pedersen, Representation, SeveralDlog,
-// DlogEq,SeveralDlogEq and DHTripple protocols.
+// DlogEq, SeveralDlogEq, DHTripple, PedersenMult, PedersenMultOpenOne,
+// ElGamalEnc and ElGamalReEnc protocols.
 
 namespace yacl::crypto {
 
@@ -73,12 +75,40 @@ enum class SigmaType {
   //             z3 = h3^x2·h2^(r3-x2·r1) (implying z3 has x3 = x1 * x2),
   // So we could proof that we have witnesses to open such 3 commitments(z1, z2,
   // z3)
+  // Witness layout: {x1, r1, x2, r2, r3}, meta: (5 2 3).
+  // The first message is R1 = h1^k1·h2^k2, R2 = h1^k3·h2^k4, R3 = z1^k3·h2^k5,
+  // R2 & R3 share k3, which binds x2 in z2 and z3.
   PedersenMult,
   // Description: know underlying multiplication relation of three Pedersen
   //   commitments, but here we could choose to open a pair (x, r).
   // Note: It's underlying homomorphism is Pedersen.
   // Secret: x1, r1, (x2, r2), x3, r3 [Choose open x2, r2]
+  // Witness layout: {x1, r1, x2, r2, r3}, meta: (5 2 3).
+  // As x2 is public, z3/z1^x2 = h2^(r3-x2·r1) is a commitment to 0, so the
+  // first message is only R1 = h1^k1·h2^k2, R3 = h2^k5, and the proof is
+  // {s1, s2, x2, r2, s5}, where x2 & r2 are in clear and checked against z2.
   PedersenMultOpenOne,
+  // Description: know the plaintext & randomness of an EC-ElGamal ciphertext,
+  //   where the plaintext is the value of a Pedersen commitment. (3 4 3)
+  // Secret: m, r, s,
+  // Generators: h1 (base of ElGamal), h2 (base of plaintexts), h3 (public
+  //   key), h4 (base of blindings in the commitment),
+  // Statement:  c1 = h1^r, c2 = h2^m·h3^r, v = h2^m·h4^s,
+  // i.e. ciphertext (c1, c2) encrypts the value committed in v. c2 & v share
+  // the response of m, which binds the plaintext to the committed value.
+  ElGamalEnc,
+  // Description: know the randomness of re-encrypting an EC-ElGamal
+  //   ciphertext. (1 2 4)
+  // Secret: r,
+  // Generators: h1 (base of ElGamal), h2 (public key),
+  // Statement:  c1, c2, c1' = c1·h1^r, c2' = c2·h2^r,
+  // i.e. (c1', c2') is a re-randomization of (c1, c2), which encrypts the
+  // same plaintext. Use ToReEncStatement() to build statements.
+  // It's DlogEq over (c1'/c1, c2'/c2), and the divisions are merged into the
+  // multiplications of verification, e.g. R1 = h1^s·c1'^-c·c1^c, so the
+  // statement is the ciphertexts themselves. The first message is only
+  // R1 = h1^k, R2 = h2^k.
+  ElGamalReEnc,
 };
 
 struct SigmaMeta {
@@ -89,31 +119,86 @@ struct SigmaMeta {
   bool varied_size_flag = false;  // true for any numXXX is 0
 };
 
+// See sigma_proof_view.h for the binary format of proofs and the views to
+// deserialize them.
 struct SigmaNIShortProof {
   SigmaType type;
   std::vector<MPInt> proof;
   MPInt challenge;
+
+  void Serialize(const EcGroup& group, Buffer* buf) const;
+  Buffer Serialize(const EcGroup& group) const;
 };
 
 struct SigmaNIBatchProof {
   SigmaType type;
   std::vector<MPInt> proof;
   std::vector<EcPoint> rnd_statement;
+
+  void Serialize(const EcGroup& group, Buffer* buf) const;
+  Buffer Serialize(const EcGroup& group) const;
 };
 
+// Short proofs of n instances of one relation under a shared challenge, where
+// responses of the i-th instance are proof[i * num_witness, (i+1) *
+// num_witness). It is n - 1 challenges shorter than n short proofs.
+struct SigmaNIAggregatedProof {
+  SigmaType type;
+  std::vector<MPInt> proof;
+  MPInt challenge;
+
+  void Serialize(const EcGroup& group, Buffer* buf) const;
+  Buffer Serialize(const EcGroup& group) const;
+};
+
+namespace internal {
+
+// Transcript state after absorbing the constant prefix of challenges: meta &
+// generators. Shared by SigmaProtocol and SigmaProtocolT, so that both produce
+// the same challenges for the same relation.
+Transcript CreateSigmaTranscriptPrefix(const EcGroup& group,
+                                       absl::Span<const EcPoint> generators,
+                                       const SigmaMeta& meta,
+                                       HashAlgorithm hash);
+
+// challenge = Hash(prefix || statement || rnd_statement || other_info)
+MPInt GetSigmaChallenge(const Transcript& prefix, const EcGroup& group,
+                        absl::Span<const EcPoint> statement,
+                        absl::Span<const EcPoint> rnd_statement,
+                        ByteContainerView other_info);
+
+// Map the digest of a transcript to a challenge in [0, order), see
+// Transcript::ChallengeScalar
+MPInt SigmaChallengeFromTranscript(const Transcript& transcript,
+                                   const MPInt& order);
+
+}  // namespace internal
+
+class SigmaComposition;
+
 class SigmaProtocol {
  public:
+  // bit length of the random weights used in VerifyBatchMany
+  static constexpr size_t kBatchWeightBits = 128;
+
+  // Generators are referenced rather than copied, they must outlive the
+  // protocol and must not be changed.
   explicit SigmaProtocol(const std::unique_ptr<EcGroup>& group,
                          const std::vector<EcPoint>& generator, SigmaMeta meta,
-                         HashAlgorithm hash = HashAlgorithm::SHA256)
-      : group_ref_(group),
-        generator_ref_(generator),
-        meta_(meta),
-        order_(group_ref_->GetOrder()),
-        hash_(hash) {}
+                         HashAlgorithm hash = HashAlgorithm::SHA256);
+
+  // Opt-in: precompute fixed-base tables for the generators, so that
+  // multiplications of generators only cost point additions. Tables are
+  // shared by all live protocol instances with the same curve and
+  // generators, and are released with the last of them.
+  // Note: generators must lie in the prime-order subgroup.
+  void EnablePrecompute(
+      size_t window_bits = PrecomputedGenerators::kDefaultWindowBits);
 
   // other_info for generation of challenge as H(...||other_info)
   // rnd_witness is the same number of random stuffs for proof
+  // Verifiers check that points of proofs are in the group (statements are
+  // trusted).
   SigmaNIBatchProof ProveBatch(const std::vector<MPInt>& witness,
                                const std::vector<EcPoint>& statement,
                                const std::vector<MPInt>& rnd_witness,
@@ -122,20 +207,172 @@ class SigmaProtocol {
                    const SigmaNIBatchProof& proof,
                    ByteContainerView other_info) const;
 
+  // Verify many batch proofs (of this relation & generators) at once.
+  // All verification equations are combined with random small exponents into
+  // one multi-scalar multiplication, the soundness error of the combination
+  // is 2^-kBatchWeightBits.
+  // If the combined check fails and invalid_idx is not null, proofs are
+  // bisected to locate the bad ones, whose indexes are stored in invalid_idx.
+  bool VerifyBatchMany(const std::vector<std::vector<EcPoint>>& statements,
+                       const std::vector<SigmaNIBatchProof>& proofs,
+                       const std::vector<ByteContainerView>& other_infos,
+                       std::vector<size_t>* invalid_idx = nullptr) const;
+
   SigmaNIShortProof ProveShort(const std::vector<MPInt>& witness,
                                const std::vector<EcPoint>& statement,
                                const std::vector<MPInt>& rnd_witness,
                                ByteContainerView other_info) const;
   bool VerifyShort(const std::vector<EcPoint>& statement,
                    const SigmaNIShortProof& proof,
-                   ByteContainerView other_info);
+                   ByteContainerView other_info) const;
+
+  // Prove many independent instances of this relation in parallel by
+  // yacl::parallel_for, the i-th proof is the same as
+  // ProveBatch/ProveShort(witnesses[i], statements[i], rnd_witnesses[i],
+  // other_infos[i]).
+  std::vector<SigmaNIBatchProof> ProveBatchMany(
+      absl::Span<const std::vector<MPInt>> witnesses,
+      absl::Span<const std::vector<EcPoint>> statements,
+      absl::Span<const std::vector<MPInt>> rnd_witnesses,
+      absl::Span<const ByteContainerView> other_infos) const;
+  std::vector<SigmaNIShortProof> ProveShortMany(
+      absl::Span<const std::vector<MPInt>> witnesses,
+      absl::Span<const std::vector<EcPoint>> statements,
+      absl::Span<const std::vector<MPInt>> rnd_witnesses,
+      absl::Span<const ByteContainerView> other_infos) const;
+
+  // Prove many instances of this relation with one shared challenge:
+  //   challenge = Hash(n || statements || rnd_statements || other_info)
+  // so only one challenge is sent and one transcript is hashed for all of
+  // them. Instances are processed in parallel by yacl::parallel_for.
+  SigmaNIAggregatedProof ProveAggregated(
+      absl::Span<const std::vector<MPInt>> witnesses,
+      absl::Span<const std::vector<EcPoint>> statements,
+      absl::Span<const std::vector<MPInt>> rnd_witnesses,
+      ByteContainerView other_info) const;
+  bool VerifyAggregated(absl::Span<const std::vector<EcPoint>> statements,
+                        const SigmaNIAggregatedProof& proof,
+                        ByteContainerView other_info) const;
+
+  // Verify many short proofs in parallel. Short proofs could not be combined
+  // like VerifyBatchMany does, so each one is checked on its own.
+  // If invalid_idx is not null, indexes of invalid proofs are stored in it.
+  bool VerifyShortMany(absl::Span<const std::vector<EcPoint>> statements,
+                       absl::Span<const SigmaNIShortProof> proofs,
+                       absl::Span<const ByteContainerView> other_infos,
+                       std::vector<size_t>* invalid_idx = nullptr) const;
 
   std::vector<EcPoint> ToStatement(const std::vector<MPInt>& witness) const;
 
+  // ElGamalReEnc only, where the statement depends on the input ciphertext:
+  // Returns: (c1, c2, c1·h1^r, c2·h2^r)
+  std::vector<EcPoint> ToReEncStatement(const MPInt& r, const EcPoint& c1,
+                                        const EcPoint& c2) const;
+
  private:
+  friend class SigmaComposition;
+  friend class SigmaInteractiveProver;
+  friend class SigmaInteractiveVerifier;
+
   MPInt GetChallenge(const std::vector<EcPoint>& statement,
                      const std::vector<EcPoint>& rnd_statement,
                      ByteContainerView other_info) const;
+  // The shared challenge of aggregated proofs
+  MPInt GetAggregatedChallenge(
+      absl::Span<const std::vector<EcPoint>> statements,
+      const std::vector<std::vector<EcPoint>>& rnd_statements,
+      ByteContainerView other_info) const;
+
+  // Returns: generator_ref_[idx] * scalar
+  EcPoint MulGenerator(uint32_t idx, const MPInt& scalar) const;
+  // Returns: generator_ref_[idx] * s1 + point * s2
+  EcPoint MulGeneratorAndPoint(uint32_t idx, const MPInt& s1,
+                               const EcPoint& point, const MPInt& s2) const;
+
+  // Recompute the first message from the second one:
+  // rnd_statement = f(proof) - challenge * statement
+  std::vector<EcPoint> RecoverRndStatement(
+      const std::vector<EcPoint>& statement, const std::vector<MPInt>& proof,
+      const MPInt& challenge) const;
+
+  // VerifyBatchMany() under the given challenges, which are either
+  // Fiat-Shamir challenges or picked by an interactive verifier
+  bool VerifyWithChallenges(const std::vector<std::vector<EcPoint>>& statements,
+                            const std::vector<SigmaNIBatchProof>& proofs,
+                            absl::Span<const MPInt> challenges,
+                            std::vector<size_t>* invalid_idx) const;
+  // Check proofs in [begin, end) by one random linear combination
+  bool VerifyBatchCombined(const std::vector<std::vector<EcPoint>>& statements,
+                           const std::vector<SigmaNIBatchProof>& proofs,
+                           absl::Span<const MPInt> challenges, size_t begin,
+                           size_t end) const;
+  // Whether sizes & type of the proof match this relation, and points of the
+  // proof are in the group
+  bool IsWellFormed(const std::vector<EcPoint>& statement,
+                    const SigmaNIBatchProof& proof) const;
+  bool IsWellFormed(const std::vector<EcPoint>& statement,
+                    const SigmaNIShortProof& proof) const;
+  // Append the randomly weighted verification equations of a well-formed
+  // proof to points & scalars, while generator terms are merged into
+  // gen_coeffs. All terms sum to 0 if the proof is valid.
+  void AppendCheckTerms(const std::vector<EcPoint>& statement,
+                        const SigmaNIBatchProof& proof, const MPInt& challenge,
+                        std::vector<EcPoint>* points,
+                        std::vector<MPInt>* scalars,
+                        std::vector<MPInt>* gen_coeffs) const;
+  // Append generators * gen_coeffs to points & scalars
+  void AppendGeneratorTerms(const std::vector<MPInt>& gen_coeffs,
+                            std::vector<EcPoint>* points,
+                            std::vector<MPInt>* scalars) const;
+  // Find invalid proofs in [begin, end) by bisection
+  void LocateInvalidProofs(const std::vector<std::vector<EcPoint>>& statements,
+                           const std::vector<SigmaNIBatchProof>& proofs,
+                           absl::Span<const MPInt> challenges, size_t begin,
+                           size_t end, std::vector<size_t>* invalid_idx) const;
+
+  // Number of points in the first message, equals to num_statement except for
+  // PedersenMultOpenOne & ElGamalReEnc
+  uint32_t NumRndStatement() const;
+
+  // The first message for rnd_witness.
+  // Most relations have a fixed homomorphism, so this is ToStatement(), but
+  // the homomorphism of PedersenMult depends on the statement.
+  std::vector<EcPoint> ToRndStatement(
+      const std::vector<EcPoint>& statement,
+      const std::vector<MPInt>& rnd_witness) const;
+
+  // Returns: h1 * gen_scalars[0] + ... + hn * gen_scalars[n-1]
+  //          + points[0] * scalars[0] + ...
+  EcPoint MulGeneratorsAndPoints(absl::Span<const MPInt> gen_scalars,
+                                 absl::Span<const EcPoint> points = {},
+                                 absl::Span<const MPInt> scalars = {}) const;
+
+  // Returns: sum_i generator_ref_[gen_idx[i]] * gen_scalars[i]
+  //          + points[0] * scalars[0] + ...
+  // for relations whose equations only involve a few of the generators
+  EcPoint MulSomeGenerators(absl::Span<const uint32_t> gen_idx,
+                            absl::Span<const MPInt> gen_scalars,
+                            absl::Span<const EcPoint> points = {},
+                            absl::Span<const MPInt> scalars = {}) const;
+
+  // The opened x2, r2 of PedersenMultOpenOne must open z2, always true for
+  // other relations.
+  bool CheckOpenedValues(const std::vector<EcPoint>& statement,
+                         const std::vector<MPInt>& proof) const;
+
+  // VerifyBatchCombined() for PedersenMult & PedersenMultOpenOne
+  void AppendMultCheckTerms(const std::vector<EcPoint>& statement,
+                            const SigmaNIBatchProof& proof,
+                            const MPInt& challenge,
+                            std::vector<EcPoint>* points,
+                            std::vector<MPInt>* scalars,
+                            std::vector<MPInt>* gen_coeffs) const;
+
+  // Size checks of the *Many & aggregated provers
+  void CheckManySizes(absl::Span<const std::vector<MPInt>> witnesses,
+                      absl::Span<const std::vector<EcPoint>> statements,
+                      absl::Span<const std::vector<MPInt>> rnd_witnesses,
+                      size_t num_other_infos) const;
 
   std::vector<MPInt> ToProof(const std::vector<MPInt>& witness,
                              const std::vector<MPInt>& rnd_witness,
@@ -144,8 +381,12 @@ class SigmaProtocol {
   const std::unique_ptr<EcGroup>& group_ref_;
   const std::vector<EcPoint>& generator_ref_;
   const SigmaMeta meta_;
-  const MPInt order_;  // [0, order_-1] as challenge space
+  const MPInt& order_;  // [0, order_-1] as challenge space
   const HashAlgorithm hash_;
+  // transcript state after absorbing the constant prefix: meta & generators
+  const Transcript transcript_prefix_;
+  // fixed-base tables of generators, null if precomputation is not enabled
+  std::shared_ptr<const PrecomputedGenerators> gen_tables_;
 };
 
 }  // namespace yacl::crypto
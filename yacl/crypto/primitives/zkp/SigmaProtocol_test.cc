@@ -2,17 +2,22 @@
 
 #include "gtest/gtest.h"
 
+#include "yacl/crypto/primitives/zkp/sigma_protocol_t.h"
+
 namespace yacl::crypto::test {
 
 class SigmaProtocolTest : public ::testing::Test {
  protected:
-  void SetUp() override {
-    curve_ = openssl::OpensslGroup::Create(GetCurveMetaByName("sm2"));
+  void SetUp() override { InitCurve("sm2"); }
+
+  void InitCurve(const std::string& curve_name) {
+    curve_ = openssl::OpensslGroup::Create(GetCurveMetaByName(curve_name));
     n_ = curve_->GetOrder();
     auto cofactor = curve_->GetCofactor();
 
-    witness_.resize(3, (MPInt)0);
-    rnd_witness_.resize(3, (MPInt)0);
+    witness_.assign(3, (MPInt)0);
+    rnd_witness_.assign(3, (MPInt)0);
+    generators_.clear();
     generators_.reserve(3);
     for (uint32_t i = 0; i < 3; i++) {
       // init random witness & rnd_witness
@@ -26,8 +31,8 @@ class SigmaProtocolTest : public ::testing::Test {
       while (curve_->IsInfinity(tmp)) {
         tmp = curve_->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2,
                                   fmt::format("id{}", j++));
-        generators_[i] = tmp;
         curve_->MulInplace(&tmp, cofactor);
+        generators_[i] = tmp;
       }
     }
   }
@@ -47,6 +52,74 @@ class SigmaProtocolTest : public ::testing::Test {
     EXPECT_TRUE(protocol.VerifyShort(statement, proof_short, other_info));
   }
 
+  // Check SigmaProtocolT against the runtime SigmaProtocol
+  template <typename Protocol>
+  void StartStaticTest(ByteContainerView other_info) {
+    constexpr auto meta = Protocol::kMeta;
+    typename Protocol::Generators generators;
+    typename Protocol::Witness witness;
+    typename Protocol::Witness rnd_witness;
+    std::copy_n(generators_.begin(), meta.num_generator, generators.begin());
+    std::copy_n(witness_.begin(), meta.num_witness, witness.begin());
+    std::copy_n(rnd_witness_.begin(), meta.num_witness, rnd_witness.begin());
+
+    Protocol protocol(curve_, generators);
+    SigmaProtocol dynamic(curve_, generators_, meta);
+    auto statement = protocol.ToStatement(witness);
+    std::vector<EcPoint> dynamic_statement(statement.begin(), statement.end());
+    auto expected_statement = dynamic.ToStatement(witness_);
+    for (uint32_t i = 0; i < meta.num_statement; i++) {
+      EXPECT_TRUE(curve_->PointEqual(statement[i], expected_statement[i]));
+    }
+
+    auto proof_batch =
+        protocol.ProveBatch(witness, statement, rnd_witness, other_info);
+    EXPECT_TRUE(protocol.VerifyBatch(statement, proof_batch, other_info));
+    EXPECT_TRUE(dynamic.VerifyBatch(
+        dynamic_statement, Protocol::ToDynamic(proof_batch), other_info));
+    auto proof_short =
+        protocol.ProveShort(witness, statement, rnd_witness, other_info);
+    EXPECT_TRUE(protocol.VerifyShort(statement, proof_short, other_info));
+    EXPECT_TRUE(dynamic.VerifyShort(
+        dynamic_statement, Protocol::ToDynamic(proof_short), other_info));
+
+    // the other way round
+    auto dynamic_proof = dynamic.ProveShort(witness_, dynamic_statement,
+                                            rnd_witness_, other_info);
+    EXPECT_TRUE(protocol.VerifyShort(
+        statement, Protocol::FromDynamic(dynamic_proof), other_info));
+    dynamic_proof.proof[0] += 1_mp;
+    EXPECT_FALSE(protocol.VerifyShort(
+        statement, Protocol::FromDynamic(dynamic_proof), other_info));
+
+    // a first message outside the prime-order subgroup is rejected
+    if (curve_->GetCofactor() != 1_mp) {
+      auto forged = proof_batch;
+      forged.rnd_statement[0] =
+          curve_->Add(forged.rnd_statement[0], TorsionPoint());
+      EXPECT_FALSE(protocol.VerifyBatch(statement, forged, other_info));
+      EXPECT_FALSE(dynamic.VerifyBatch(
+          dynamic_statement, Protocol::ToDynamic(forged), other_info));
+    }
+
+    protocol.EnablePrecompute();
+    EXPECT_TRUE(protocol.VerifyBatch(statement, proof_batch, other_info));
+    proof_batch.proof[0] += 1_mp;
+    EXPECT_FALSE(protocol.VerifyBatch(statement, proof_batch, other_info));
+  }
+
+  // A point of small order, only exists on curves with a cofactor
+  EcPoint TorsionPoint() const {
+    for (uint32_t j = 0;; j++) {
+      auto p = curve_->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2,
+                                   fmt::format("torsion{}", j));
+      curve_->MulInplace(&p, n_);
+      if (!curve_->IsInfinity(p)) {
+        return p;
+      }
+    }
+  }
+
   std::unique_ptr<yacl::crypto::EcGroup> curve_;
   MPInt n_;
 
@@ -86,4 +159,446 @@ TEST_F(SigmaProtocolTest, DHTrippleTest) {
   StartTest(DHTripple, other_info);
 }
 
+TEST_F(SigmaProtocolTest, VerifyBatchManyTest) {
+  for (auto meta : {SigmaMeta{SigmaType::Representation, 3, 3, 1},
+                    SigmaMeta{SigmaType::SeveralDlog, 3, 3, 3},
+                    SigmaMeta{SigmaType::SeveralDlogEq, 1, 3, 3}}) {
+    SigmaProtocol protocol(curve_, generators_, meta);
+    const size_t num_proofs = 9;
+    std::vector<std::vector<EcPoint>> statements;
+    std::vector<SigmaNIBatchProof> proofs;
+    std::vector<std::string> infos;
+    for (size_t i = 0; i < num_proofs; i++) {
+      std::vector<MPInt> witness(meta.num_witness);
+      std::vector<MPInt> rnd_witness(meta.num_witness);
+      for (uint32_t j = 0; j < meta.num_witness; j++) {
+        MPInt::RandomLtN(n_, &witness[j]);
+        MPInt::RandomLtN(n_, &rnd_witness[j]);
+      }
+      statements.emplace_back(protocol.ToStatement(witness));
+      infos.emplace_back(fmt::format("proof-{}", i));
+      proofs.emplace_back(protocol.ProveBatch(witness, statements.back(),
+                                              rnd_witness, infos.back()));
+    }
+    std::vector<ByteContainerView> other_infos(infos.begin(), infos.end());
+
+    std::vector<size_t> invalid_idx;
+    EXPECT_TRUE(protocol.VerifyBatchMany(statements, proofs, other_infos,
+                                         &invalid_idx));
+    EXPECT_TRUE(invalid_idx.empty());
+    EXPECT_TRUE(protocol.VerifyBatchMany({}, {}, {}));
+
+    // tamper with proof 2 & 7
+    proofs[2].proof[0] = proofs[2].proof[0].AddMod(1_mp, n_);
+    other_infos[7] = "forged";
+    EXPECT_FALSE(protocol.VerifyBatchMany(statements, proofs, other_infos));
+    EXPECT_FALSE(protocol.VerifyBatchMany(statements, proofs, other_infos,
+                                          &invalid_idx));
+    EXPECT_EQ(invalid_idx, std::vector<size_t>({2, 7}));
+  }
+}
+
+TEST_F(SigmaProtocolTest, PrecomputeTest) {
+  for (auto meta : {SigmaMeta{SigmaType::Dlog, 1, 1, 1},
+                    SigmaMeta{SigmaType::Representation, 3, 3, 1},
+                    SigmaMeta{SigmaType::SeveralDlog, 3, 3, 3},
+                    SigmaMeta{SigmaType::SeveralDlogEq, 1, 3, 3}}) {
+    SigmaProtocol plain(curve_, generators_, meta);
+    SigmaProtocol fast(curve_, generators_, meta);
+    fast.EnablePrecompute();
+    ByteContainerView other_info("PrecomputeTest");
+
+    auto statement = plain.ToStatement(witness_);
+    auto fast_statement = fast.ToStatement(witness_);
+    for (uint32_t i = 0; i < meta.num_statement; i++) {
+      EXPECT_TRUE(curve_->PointEqual(statement[i], fast_statement[i]));
+    }
+
+    // proofs are interchangeable
+    auto proof_batch =
+        fast.ProveBatch(witness_, statement, rnd_witness_, other_info);
+    EXPECT_TRUE(plain.VerifyBatch(statement, proof_batch, other_info));
+    EXPECT_TRUE(fast.VerifyBatch(statement, proof_batch, other_info));
+    EXPECT_TRUE(fast.VerifyBatchMany({statement}, {proof_batch}, {other_info}));
+    proof_batch.proof[0] += 1_mp;
+    EXPECT_FALSE(fast.VerifyBatch(statement, proof_batch, other_info));
+    auto proof_short =
+        plain.ProveShort(witness_, statement, rnd_witness_, other_info);
+    EXPECT_TRUE(fast.VerifyShort(statement, proof_short, other_info));
+  }
+
+  // tables are shared
+  auto t1 = PrecomputedGenerators::GetOrCreate(*curve_, generators_);
+  auto t2 = PrecomputedGenerators::GetOrCreate(*curve_, generators_);
+  EXPECT_EQ(t1.get(), t2.get());
+  EXPECT_EQ(t1->Size(), generators_.size());
+  auto s = -12345_mp;
+  EXPECT_TRUE(curve_->PointEqual(t1->Mul(*curve_, 2, s),
+                                 curve_->Mul(generators_[2], s)));
+  EXPECT_TRUE(curve_->IsInfinity(t1->Mul(*curve_, 1, n_)));
+
+  // tables of per-instance generators do not pile up once released
+  for (uint32_t i = 0; i < 8; i++) {
+    std::vector<EcPoint> generators = {curve_->MulBase(MPInt(i + 2))};
+    SigmaProtocol protocol(curve_, generators, {SigmaType::Dlog, 1, 1, 1});
+    protocol.EnablePrecompute();
+  }
+  EXPECT_LE(PrecomputedGenerators::CacheSize(), 2);
+  EXPECT_EQ(PrecomputedGenerators::GetOrCreate(*curve_, generators_).get(),
+            t1.get());
+  PrecomputedGenerators::ClearCache();
+}
+
+TEST_F(SigmaProtocolTest, ProveManyTest) {
+  SigmaMeta meta = {SigmaType::DlogEq, 1, 2, 2};
+  SigmaProtocol protocol(curve_, generators_, meta);
+  const size_t num = 20;
+  std::vector<std::vector<MPInt>> witnesses(num, std::vector<MPInt>(1));
+  std::vector<std::vector<MPInt>> rnd_witnesses(num, std::vector<MPInt>(1));
+  std::vector<std::vector<EcPoint>> statements;
+  std::vector<std::string> infos;
+  for (size_t i = 0; i < num; i++) {
+    MPInt::RandomLtN(n_, &witnesses[i][0]);
+    MPInt::RandomLtN(n_, &rnd_witnesses[i][0]);
+    statements.emplace_back(protocol.ToStatement(witnesses[i]));
+    infos.emplace_back(fmt::format("ProveManyTest{}", i));
+  }
+  std::vector<ByteContainerView> other_infos(infos.begin(), infos.end());
+
+  auto batch_proofs = protocol.ProveBatchMany(witnesses, statements,
+                                              rnd_witnesses, other_infos);
+  ASSERT_EQ(batch_proofs.size(), num);
+  EXPECT_TRUE(protocol.VerifyBatchMany(statements, batch_proofs, other_infos));
+
+  auto short_proofs = protocol.ProveShortMany(witnesses, statements,
+                                              rnd_witnesses, other_infos);
+  ASSERT_EQ(short_proofs.size(), num);
+  for (size_t i = 0; i < num; i++) {
+    // same as the serial prover
+    auto proof = protocol.ProveShort(witnesses[i], statements[i],
+                                     rnd_witnesses[i], other_infos[i]);
+    EXPECT_EQ(short_proofs[i].challenge, proof.challenge);
+    EXPECT_EQ(short_proofs[i].proof, proof.proof);
+  }
+  std::vector<size_t> invalid_idx;
+  EXPECT_TRUE(protocol.VerifyShortMany(statements, short_proofs, other_infos,
+                                       &invalid_idx));
+  EXPECT_TRUE(invalid_idx.empty());
+
+  short_proofs[3].proof[0] += 1_mp;
+  short_proofs[11].proof.clear();
+  std::swap(other_infos[15], other_infos[16]);
+  EXPECT_FALSE(protocol.VerifyShortMany(statements, short_proofs, other_infos,
+                                        &invalid_idx));
+  EXPECT_EQ(invalid_idx, (std::vector<size_t>{3, 11, 15, 16}));
+
+  EXPECT_ANY_THROW(protocol.ProveShortMany(
+      witnesses, absl::MakeConstSpan(statements).subspan(1), rnd_witnesses,
+      other_infos));
+}
+
+TEST_F(SigmaProtocolTest, AggregatedProofTest) {
+  SigmaMeta meta = {SigmaType::DlogEq, 1, 2, 2};
+  SigmaProtocol protocol(curve_, generators_, meta);
+  const size_t num = 20;
+  std::vector<std::vector<MPInt>> witnesses(num, std::vector<MPInt>(1));
+  std::vector<std::vector<MPInt>> rnd_witnesses(num, std::vector<MPInt>(1));
+  std::vector<std::vector<EcPoint>> statements;
+  for (size_t i = 0; i < num; i++) {
+    MPInt::RandomLtN(n_, &witnesses[i][0]);
+    MPInt::RandomLtN(n_, &rnd_witnesses[i][0]);
+    statements.emplace_back(protocol.ToStatement(witnesses[i]));
+  }
+
+  auto proof =
+      protocol.ProveAggregated(witnesses, statements, rnd_witnesses, "info");
+  ASSERT_EQ(proof.proof.size(), num);
+  EXPECT_TRUE(protocol.VerifyAggregated(statements, proof, "info"));
+  EXPECT_FALSE(protocol.VerifyAggregated(statements, proof, "other"));
+  // responses are bound to their own statements
+  auto swapped = statements;
+  std::swap(swapped[3], swapped[4]);
+  EXPECT_FALSE(protocol.VerifyAggregated(swapped, proof, "info"));
+  EXPECT_FALSE(protocol.VerifyAggregated(
+      absl::MakeConstSpan(statements).subspan(1), proof, "info"));
+  auto forged = proof;
+  forged.proof[7] += 1_mp;
+  EXPECT_FALSE(protocol.VerifyAggregated(statements, forged, "info"));
+
+  // a single instance is not the same as a short proof, as the instance
+  // count is hashed
+  auto single = protocol.ProveAggregated(
+      absl::MakeConstSpan(witnesses).subspan(0, 1),
+      absl::MakeConstSpan(statements).subspan(0, 1),
+      absl::MakeConstSpan(rnd_witnesses).subspan(0, 1), "info");
+  EXPECT_TRUE(protocol.VerifyAggregated(
+      absl::MakeConstSpan(statements).subspan(0, 1), single, "info"));
+  EXPECT_FALSE(protocol.VerifyShort(
+      statements[0], {single.type, single.proof, single.challenge}, "info"));
+
+  EXPECT_ANY_THROW(protocol.ProveAggregated(
+      witnesses, absl::MakeConstSpan(statements).subspan(1), rnd_witnesses,
+      "info"));
+}
+
+TEST_F(SigmaProtocolTest, PedersenMultTest) {
+  for (auto type : {SigmaType::PedersenMult, SigmaType::PedersenMultOpenOne}) {
+    SigmaMeta meta = {type, 5, 2, 3};
+    SigmaProtocol protocol(curve_, generators_, meta);
+    ByteContainerView other_info("PedersenMultTest");
+    // x1, r1, x2, r2, r3
+    std::vector<MPInt> witness(5);
+    std::vector<MPInt> rnd_witness(5);
+    for (size_t i = 0; i < 5; i++) {
+      MPInt::RandomLtN(n_, &witness[i]);
+      MPInt::RandomLtN(n_, &rnd_witness[i]);
+    }
+    auto statement = protocol.ToStatement(witness);
+    ASSERT_EQ(statement.size(), 3);
+    EXPECT_TRUE(curve_->PointEqual(
+        statement[2],
+        curve_->MultiScalarMul({generators_[0], generators_[1]},
+                               {witness[0].MulMod(witness[2], n_),
+                                witness[4]})));
+
+    auto proof_batch =
+        protocol.ProveBatch(witness, statement, rnd_witness, other_info);
+    EXPECT_TRUE(protocol.VerifyBatch(statement, proof_batch, other_info));
+    auto proof_short =
+        protocol.ProveShort(witness, statement, rnd_witness, other_info);
+    EXPECT_TRUE(protocol.VerifyShort(statement, proof_short, other_info));
+    EXPECT_TRUE(protocol.VerifyBatchMany({statement, statement},
+                                         {proof_batch, proof_batch},
+                                         {other_info, other_info}));
+    if (type == SigmaType::PedersenMultOpenOne) {
+      EXPECT_EQ(proof_batch.rnd_statement.size(), 2);
+      EXPECT_EQ(proof_short.proof[2], witness[2]);
+      EXPECT_EQ(proof_short.proof[3], witness[3]);
+    }
+
+    SigmaProtocol fast(curve_, generators_, meta);
+    fast.EnablePrecompute();
+    EXPECT_TRUE(fast.VerifyShort(statement, proof_short, other_info));
+    EXPECT_TRUE(fast.VerifyBatchMany({statement}, {proof_batch}, {other_info}));
+
+    // z3 does not commit to x1 * x2
+    auto bad_witness = witness;
+    bad_witness[4] += 1_mp;
+    auto bad_statement = statement;
+    bad_statement[2] = protocol.ToStatement(bad_witness)[2];
+    bad_statement[2] = curve_->Add(bad_statement[2], generators_[0]);
+    auto bad_proof =
+        protocol.ProveShort(bad_witness, bad_statement, rnd_witness, "");
+    EXPECT_FALSE(protocol.VerifyShort(bad_statement, bad_proof, ""));
+    auto bad_batch =
+        protocol.ProveBatch(bad_witness, bad_statement, rnd_witness, "");
+    EXPECT_FALSE(protocol.VerifyBatch(bad_statement, bad_batch, ""));
+    EXPECT_FALSE(protocol.VerifyBatchMany({bad_statement}, {bad_batch}, {""}));
+
+    // every response is checked
+    for (size_t i = 0; i < 5; i++) {
+      auto forged = proof_batch;
+      forged.proof[i] = forged.proof[i].AddMod(1_mp, n_);
+      EXPECT_FALSE(protocol.VerifyBatch(statement, forged, other_info));
+      EXPECT_FALSE(
+          protocol.VerifyBatchMany({statement}, {forged}, {other_info}));
+      auto forged_short = proof_short;
+      forged_short.proof[i] = forged_short.proof[i].AddMod(1_mp, n_);
+      EXPECT_FALSE(protocol.VerifyShort(statement, forged_short, other_info));
+    }
+  }
+  PrecomputedGenerators::ClearCache();
+}
+
+TEST_F(SigmaProtocolTest, ElGamalEncTest) {
+  // g, base of plaintexts, public key & base of blindings
+  std::vector<EcPoint> generators = {curve_->GetGenerator(), generators_[0],
+                                     generators_[1], generators_[2]};
+  SigmaMeta meta = {SigmaType::ElGamalEnc, 3, 4, 3};
+  SigmaProtocol protocol(curve_, generators, meta);
+  ByteContainerView other_info("ElGamalEncTest");
+  // m, r, s
+  std::vector<MPInt> witness(3);
+  std::vector<MPInt> rnd_witness(3);
+  for (size_t i = 0; i < 3; i++) {
+    MPInt::RandomLtN(n_, &witness[i]);
+    MPInt::RandomLtN(n_, &rnd_witness[i]);
+  }
+  auto statement = protocol.ToStatement(witness);
+  ASSERT_EQ(statement.size(), 3);
+  EXPECT_TRUE(curve_->PointEqual(
+      statement[1], curve_->MultiScalarMul({generators[1], generators[2]},
+                                           {witness[0], witness[1]})));
+
+  auto proof_batch =
+      protocol.ProveBatch(witness, statement, rnd_witness, other_info);
+  EXPECT_TRUE(protocol.VerifyBatch(statement, proof_batch, other_info));
+  auto proof_short =
+      protocol.ProveShort(witness, statement, rnd_witness, other_info);
+  EXPECT_TRUE(protocol.VerifyShort(statement, proof_short, other_info));
+  EXPECT_TRUE(protocol.VerifyBatchMany({statement, statement},
+                                       {proof_batch, proof_batch},
+                                       {other_info, other_info}));
+  SigmaProtocol fast(curve_, generators, meta);
+  fast.EnablePrecompute();
+  EXPECT_TRUE(fast.VerifyShort(statement, proof_short, other_info));
+  EXPECT_TRUE(fast.VerifyBatchMany({statement}, {proof_batch}, {other_info}));
+
+  // the ciphertext encrypts another value than the committed one
+  auto bad_witness = witness;
+  bad_witness[0] += 1_mp;
+  auto bad_statement = statement;
+  bad_statement[2] = protocol.ToStatement(bad_witness)[2];
+  auto bad_proof =
+      protocol.ProveShort(witness, bad_statement, rnd_witness, other_info);
+  EXPECT_FALSE(protocol.VerifyShort(bad_statement, bad_proof, other_info));
+  auto bad_batch =
+      protocol.ProveBatch(witness, bad_statement, rnd_witness, other_info);
+  EXPECT_FALSE(protocol.VerifyBatch(bad_statement, bad_batch, other_info));
+  EXPECT_FALSE(
+      protocol.VerifyBatchMany({bad_statement}, {bad_batch}, {other_info}));
+  PrecomputedGenerators::ClearCache();
+}
+
+TEST_F(SigmaProtocolTest, ElGamalReEncTest) {
+  // g & public key
+  std::vector<EcPoint> generators = {curve_->GetGenerator(), generators_[0]};
+  SigmaMeta meta = {SigmaType::ElGamalReEnc, 1, 2, 4};
+  SigmaProtocol protocol(curve_, generators, meta);
+  ByteContainerView other_info("ElGamalReEncTest");
+  MPInt m;
+  MPInt r;
+  MPInt::RandomLtN(n_, &m);
+  MPInt::RandomLtN(n_, &r);
+  auto c1 = curve_->MulBase(r);
+  auto c2 = curve_->MultiScalarMul({generators_[1], generators_[0]}, {m, r});
+
+  std::vector<MPInt> witness(1);
+  std::vector<MPInt> rnd_witness(1);
+  MPInt::RandomLtN(n_, &witness[0]);
+  MPInt::RandomLtN(n_, &rnd_witness[0]);
+  EXPECT_ANY_THROW(protocol.ToStatement(witness));
+  auto statement = protocol.ToReEncStatement(witness[0], c1, c2);
+  ASSERT_EQ(statement.size(), 4);
+  // still encrypts m under randomness r + r'
+  auto r2 = r.AddMod(witness[0], n_);
+  EXPECT_TRUE(curve_->PointEqual(statement[2], curve_->MulBase(r2)));
+  EXPECT_TRUE(curve_->PointEqual(
+      statement[3],
+      curve_->MultiScalarMul({generators_[1], generators_[0]}, {m, r2})));
+
+  auto proof_batch =
+      protocol.ProveBatch(witness, statement, rnd_witness, other_info);
+  EXPECT_EQ(proof_batch.rnd_statement.size(), 2);
+  EXPECT_TRUE(protocol.VerifyBatch(statement, proof_batch, other_info));
+  auto proof_short =
+      protocol.ProveShort(witness, statement, rnd_witness, other_info);
+  EXPECT_TRUE(protocol.VerifyShort(statement, proof_short, other_info));
+  SigmaProtocol fast(curve_, generators, meta);
+  fast.EnablePrecompute();
+  EXPECT_TRUE(fast.VerifyShort(statement, proof_short, other_info));
+
+  // re-encryptions of other ciphertexts, one of them changes the plaintext
+  std::vector<std::vector<EcPoint>> statements = {statement};
+  std::vector<SigmaNIBatchProof> proofs = {proof_batch};
+  for (size_t i = 0; i < 3; i++) {
+    auto s = protocol.ToReEncStatement(witness[0], c2, c1);
+    if (i == 1) {
+      s[3] = curve_->Add(s[3], generators_[1]);
+    }
+    proofs.emplace_back(
+        protocol.ProveBatch(witness, s, rnd_witness, other_info));
+    statements.emplace_back(std::move(s));
+  }
+  std::vector<size_t> invalid_idx;
+  EXPECT_FALSE(protocol.VerifyBatchMany(
+      statements, proofs, std::vector<ByteContainerView>(4, other_info),
+      &invalid_idx));
+  EXPECT_EQ(invalid_idx, std::vector<size_t>{2});
+  statements.erase(statements.begin() + 2);
+  proofs.erase(proofs.begin() + 2);
+  EXPECT_TRUE(protocol.VerifyBatchMany(
+      statements, proofs, std::vector<ByteContainerView>(3, other_info)));
+  PrecomputedGenerators::ClearCache();
+}
+
+TEST_F(SigmaProtocolTest, StaticProtocolTest) {
+  // secp112r2 has cofactor 4
+  for (const auto* curve_name : {"sm2", "secp112r2"}) {
+    InitCurve(curve_name);
+    StartStaticTest<DlogProtocol>("DlogProtocol");
+    StartStaticTest<PedersenProtocol>("PedersenProtocol");
+    StartStaticTest<DlogEqProtocol>("DlogEqProtocol");
+    StartStaticTest<SigmaProtocolT<SigmaType::Representation, 3, 3, 1>>(
+        "Representation");
+    StartStaticTest<SigmaProtocolT<SigmaType::SeveralDlog, 3, 3, 3>>(
+        "SeveralDlog");
+  }
+  PrecomputedGenerators::ClearCache();
+}
+
+TEST_F(SigmaProtocolTest, TamperedProofTest) {
+  SigmaMeta meta = {SigmaType::Representation, 3, 3, 1};
+  SigmaProtocol protocol(curve_, generators_, meta);
+  ByteContainerView other_info("TamperedProofTest");
+  auto statement = protocol.ToStatement(witness_);
+  auto proof =
+      protocol.ProveShort(witness_, statement, rnd_witness_, other_info);
+  ASSERT_TRUE(protocol.VerifyShort(statement, proof, other_info));
+
+  // every response is bound by the challenge
+  for (uint32_t i = 0; i < meta.num_witness; i++) {
+    auto forged = proof;
+    forged.proof[i] = forged.proof[i].AddMod(1_mp, n_);
+    EXPECT_FALSE(protocol.VerifyShort(statement, forged, other_info));
+  }
+  // so is the statement
+  auto forged_statement = statement;
+  forged_statement[0] = curve_->Add(statement[0], generators_[0]);
+  EXPECT_FALSE(protocol.VerifyShort(forged_statement, proof, other_info));
+  EXPECT_FALSE(protocol.VerifyShort(statement, proof, "other"));
+}
+
+TEST_F(SigmaProtocolTest, MalformedProofTest) {
+  ByteContainerView other_info("MalformedProofTest");
+  for (SigmaMeta meta : {SigmaMeta{SigmaType::Dlog, 1, 1, 1},
+                         SigmaMeta{SigmaType::PedersenMultOpenOne, 5, 2, 3}}) {
+    SigmaProtocol protocol(curve_, generators_, meta);
+    std::vector<MPInt> witness(5);
+    std::vector<MPInt> rnd_witness(5);
+    for (uint32_t i = 0; i < 5; i++) {
+      MPInt::RandomLtN(n_, &witness[i]);
+      MPInt::RandomLtN(n_, &rnd_witness[i]);
+    }
+    auto statement = protocol.ToStatement(witness);
+    auto batch =
+        protocol.ProveBatch(witness, statement, rnd_witness, other_info);
+    auto short_proof =
+        protocol.ProveShort(witness, statement, rnd_witness, other_info);
+    ASSERT_TRUE(protocol.VerifyBatch(statement, batch, other_info));
+    ASSERT_TRUE(protocol.VerifyShort(statement, short_proof, other_info));
+
+    auto truncated = batch;
+    truncated.rnd_statement.clear();
+    EXPECT_FALSE(protocol.VerifyBatch(statement, truncated, other_info));
+    truncated = batch;
+    truncated.proof.pop_back();
+    EXPECT_FALSE(protocol.VerifyBatch(statement, truncated, other_info));
+    truncated = batch;
+    truncated.type = SigmaType::Representation;
+    EXPECT_FALSE(protocol.VerifyBatch(statement, truncated, other_info));
+    EXPECT_FALSE(protocol.VerifyBatch({}, batch, other_info));
+
+    auto truncated_short = short_proof;
+    truncated_short.proof.clear();
+    EXPECT_FALSE(protocol.VerifyShort(statement, truncated_short, other_info));
+    truncated_short = short_proof;
+    truncated_short.proof.pop_back();
+    EXPECT_FALSE(protocol.VerifyShort(statement, truncated_short, other_info));
+    EXPECT_FALSE(protocol.VerifyShort({}, short_proof, other_info));
+    EXPECT_FALSE(protocol.VerifyShortMany({statement}, {truncated_short},
+                                          {other_info}));
+  }
+}
+
 }  // namespace yacl::crypto::test
\ No newline at end of file
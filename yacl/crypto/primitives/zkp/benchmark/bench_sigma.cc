@@ -0,0 +1,601 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+
+#include "absl/strings/str_split.h"
+#include "benchmark/benchmark.h"
+#include "gflags/gflags.h"
+
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+#include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
+#include "yacl/crypto/primitives/zkp/range_proof.h"
+#include "yacl/crypto/primitives/zkp/shuffle_proof.h"
+#include "yacl/crypto/primitives/zkp/sigma_composition.h"
+#include "yacl/crypto/primitives/zkp/sigma_proof_view.h"
+
+namespace yacl::crypto::bench {
+
+DEFINE_string(curve, "sm2", "Select curve to bench");
+DEFINE_string(lib, "", "Select lib to bench");
+DEFINE_string(hash, "sha256",
+              "Select hash algorithms of challenges to bench, from sha256, "
+              "sha384, sha512, sm3, blake2b and blake3");
+
+namespace {
+
+HashAlgorithm GetHashByName(const std::string& name) {
+  static const std::map<std::string, HashAlgorithm> kHashes = {
+      {"sha256", HashAlgorithm::SHA256}, {"sha384", HashAlgorithm::SHA384},
+      {"sha512", HashAlgorithm::SHA512}, {"sm3", HashAlgorithm::SM3},
+      {"blake2b", HashAlgorithm::BLAKE2B}, {"blake3", HashAlgorithm::BLAKE3}};
+  auto it = kHashes.find(name);
+  YACL_ENFORCE(it != kHashes.end(), "Unsupported hash {}", name);
+  return it->second;
+}
+
+struct SigmaCase {
+  const char* name;
+  SigmaType type;
+  // whether the relation is over a varied number of witnesses or generators
+  bool varied;
+};
+
+constexpr SigmaCase kSigmaCases[] = {
+    {"Dlog", SigmaType::Dlog, false},
+    {"Pedersen", SigmaType::Pedersen, false},
+    {"Representation", SigmaType::Representation, true},
+    {"SeveralDlog", SigmaType::SeveralDlog, true},
+    {"DlogEq", SigmaType::DlogEq, false},
+    {"SeveralDlogEq", SigmaType::SeveralDlogEq, true},
+    {"DHTripple", SigmaType::DHTripple, false},
+    {"PedersenMult", SigmaType::PedersenMult, false},
+    {"PedersenMultOpenOne", SigmaType::PedersenMultOpenOne, false},
+    {"ElGamalEnc", SigmaType::ElGamalEnc, false},
+    {"ElGamalReEnc", SigmaType::ElGamalReEnc, false},
+};
+
+// Meta of a relation, n is the size of the varied dimension
+SigmaMeta GetMeta(SigmaType type, uint32_t n) {
+  switch (type) {
+    case SigmaType::Dlog:
+      return {type, 1, 1, 1};
+    case SigmaType::Pedersen:
+      return {type, 2, 2, 1};
+    case SigmaType::Representation:
+      return {type, n, n, 1};
+    case SigmaType::SeveralDlog:
+      return {type, n, n, n};
+    case SigmaType::DlogEq:
+    case SigmaType::DHTripple:
+      return {type, 1, 2, 2};
+    case SigmaType::SeveralDlogEq:
+      return {type, 1, n, n};
+    case SigmaType::PedersenMult:
+    case SigmaType::PedersenMultOpenOne:
+      return {type, 5, 2, 3};
+    case SigmaType::ElGamalEnc:
+      return {type, 3, 4, 3};
+    case SigmaType::ElGamalReEnc:
+      return {type, 1, 2, 4};
+    default:
+      YACL_THROW("Unsupported sigma type {}", static_cast<int>(type));
+  }
+}
+
+enum class SigmaOp {
+  ToStatement,
+  ProveBatch,
+  VerifyBatch,
+  ProveShort,
+  VerifyShort,
+  GetChallenge,
+};
+
+constexpr std::pair<const char*, SigmaOp> kSigmaOps[] = {
+    {"ToStatement", SigmaOp::ToStatement},
+    {"ProveBatch", SigmaOp::ProveBatch},
+    {"VerifyBatch", SigmaOp::VerifyBatch},
+    {"ProveShort", SigmaOp::ProveShort},
+    {"VerifyShort", SigmaOp::VerifyShort},
+    {"GetChallenge", SigmaOp::GetChallenge},
+};
+
+}  // namespace
+
+class SigmaBencher {
+ public:
+  explicit SigmaBencher(std::unique_ptr<EcGroup> ec) : ec_(std::move(ec)) {}
+
+  void Register() {
+    std::string prefix =
+        fmt::format("{}/{}", ec_->GetCurveName(), ec_->GetLibraryName());
+    fmt::print("Register {}\n", prefix);
+
+    // Matrix of relations x operations x hash algorithms, the arg is the size
+    // of the varied dimension (1 for relations of fixed size).
+    std::vector<std::string> hashes = absl::StrSplit(
+        FLAGS_hash, absl::ByAnyChar(";,.|&+"), absl::SkipWhitespace());
+    for (const auto& hash_name : hashes) {
+      HashAlgorithm hash = GetHashByName(hash_name);
+      for (const auto& sigma_case : kSigmaCases) {
+        for (const auto& [op_name, op] : kSigmaOps) {
+          auto* bench = benchmark::RegisterBenchmark(
+              fmt::format("{}/{}/BM_Sigma{}/{}", prefix, hash_name, op_name,
+                          sigma_case.name)
+                  .c_str(),
+              [this, type = sigma_case.type, op = op,
+               hash](benchmark::State& st) {
+                BenchSigma(st, type, op, hash);
+              });
+          if (sigma_case.varied) {
+            bench->RangeMultiplier(4)->Range(1, 256);
+          } else {
+            bench->Arg(1);
+          }
+        }
+      }
+
+      // Arg: number of bytes absorbed before the challenge. Run with
+      // --hash=sha256,blake3 to compare the hash algorithms.
+      benchmark::RegisterBenchmark(
+          fmt::format("{}/{}/BM_HashToScalar", prefix, hash_name).c_str(),
+          [this, hash](benchmark::State& st) { BenchHashToScalar(st, hash); })
+          ->RangeMultiplier(4)
+          ->Range(64, 16384);
+    }
+
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_SerializeBatchProof", prefix).c_str(),
+        [this](benchmark::State& st) { BenchSerializeBatchProof(st); })
+        ->Arg(1)
+        ->Arg(16);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_DeserializeBatchProof", prefix).c_str(),
+        [this](benchmark::State& st) { BenchDeserializeBatchProof(st); })
+        ->Arg(1)
+        ->Arg(16);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_SerializeShortProof", prefix).c_str(),
+        [this](benchmark::State& st) { BenchSerializeShortProof(st); })
+        ->Arg(1)
+        ->Arg(16);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_DeserializeShortProof", prefix).c_str(),
+        [this](benchmark::State& st) { BenchDeserializeShortProof(st); })
+        ->Arg(1)
+        ->Arg(16);
+
+    // Arg: 0 for PedersenMult, 1 for PedersenMultOpenOne, 2 for three
+    // independent Pedersen proofs as baseline
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_PedersenMultProve", prefix).c_str(),
+        [this](benchmark::State& st) { BenchPedersenMult(st, true); })
+        ->DenseRange(0, 2);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_PedersenMultVerify", prefix).c_str(),
+        [this](benchmark::State& st) { BenchPedersenMult(st, false); })
+        ->DenseRange(0, 2);
+
+    // Arg: 0 for a 64-bit Bulletproofs range proof, 1 for the naive bit
+    // decomposition with 64 OR proofs as baseline
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_RangeProve", prefix).c_str(),
+        [this](benchmark::State& st) { BenchRange(st, true); })
+        ->DenseRange(0, 1)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_RangeVerify", prefix).c_str(),
+        [this](benchmark::State& st) { BenchRange(st, false); })
+        ->DenseRange(0, 1)
+        ->Unit(benchmark::kMillisecond);
+
+    // Arg: number of DlogEq instances, proven by as many short proofs or by
+    // one aggregated proof. Counter proof_bytes is the serialized size.
+    for (bool aggregated : {false, true}) {
+      const char* name = aggregated ? "Aggregated" : "ShortMany";
+      benchmark::RegisterBenchmark(
+          fmt::format("{}/BM_{}Prove", prefix, name).c_str(),
+          [this, aggregated](benchmark::State& st) {
+            BenchAggregated(st, aggregated, true);
+          })
+          ->RangeMultiplier(8)
+          ->Range(1, 512);
+      benchmark::RegisterBenchmark(
+          fmt::format("{}/BM_{}Verify", prefix, name).c_str(),
+          [this, aggregated](benchmark::State& st) {
+            BenchAggregated(st, aggregated, false);
+          })
+          ->RangeMultiplier(8)
+          ->Range(1, 512);
+    }
+
+    // Arg: number of shuffled ciphertexts
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_ShuffleProve", prefix).c_str(),
+        [this](benchmark::State& st) { BenchShuffle(st, true); })
+        ->RangeMultiplier(10)
+        ->Range(10, 100000)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(
+        fmt::format("{}/BM_ShuffleVerify", prefix).c_str(),
+        [this](benchmark::State& st) { BenchShuffle(st, false); })
+        ->RangeMultiplier(10)
+        ->Range(10, 100000)
+        ->Unit(benchmark::kMillisecond);
+  }
+
+  void BenchRange(benchmark::State& state, bool prove) {
+    const auto& order = ec_->GetOrder();
+    MPInt tmp;
+    MPInt::RandomLtN(order, &tmp);
+    EcPoint h = ec_->MulBase(tmp);
+    std::unique_ptr<RangeProtocol> protocol_ptr;
+    try {
+      protocol_ptr =
+          std::make_unique<RangeProtocol>(ec_, ec_->GetGenerator(), h);
+    } catch (const yacl::Exception& e) {
+      // generators are derived by HashToCurve, which not all libs support
+      state.SkipWithError(e.what());
+      return;
+    }
+    const auto& protocol = *protocol_ptr;
+    MPInt value;
+    MPInt::RandomExactBits(RangeProtocol::kMaxBits, &value);
+
+    if (state.range() == 0) {
+      MPInt blinding;
+      MPInt::RandomLtN(order, &blinding);
+      std::vector<EcPoint> commitments = {protocol.Commit(value, blinding)};
+      auto proof = protocol.Prove({value}, {blinding}, "");
+      for (auto _ : state) {
+        if (prove) {
+          protocol.Prove({value}, {blinding}, "");
+        } else {
+          protocol.Verify(commitments, proof, "");
+        }
+      }
+      return;
+    }
+
+    // Commit every bit by C_i = g^b_i·h^r_i, and prove C_i or C_i/g is a
+    // power of h. The verifier also checks prod C_i^(2^i) == V, where the
+    // blinding of V is sum r_i·2^i.
+    std::vector<EcPoint> dlog_generators = {h};
+    SigmaProtocol dlog(ec_, dlog_generators, {SigmaType::Dlog, 1, 1, 1});
+    SigmaComposition composition({&dlog, &dlog});
+    const size_t n = RangeProtocol::kMaxBits;
+    std::vector<MPInt> blindings(n);
+    std::vector<MPInt> powers(n);
+    std::vector<EcPoint> bit_commitments;
+    std::vector<std::vector<std::vector<EcPoint>>> statements;
+    MPInt blinding = 0_mp;
+    for (size_t i = 0; i < n; i++) {
+      MPInt::RandomLtN(order, &blindings[i]);
+      powers[i] = 1_mp << i;
+      blinding = blinding.AddMod(blindings[i].MulMod(powers[i], order), order);
+      bit_commitments.emplace_back(
+          protocol.Commit(MPInt(value.GetBit(i)), blindings[i]));
+      statements.push_back(
+          {{bit_commitments[i]},
+           {ec_->Sub(bit_commitments[i], ec_->GetGenerator())}});
+    }
+    EcPoint commitment = protocol.Commit(value, blinding);
+    auto prove_bits = [&] {
+      std::vector<SigmaOrProof> proofs;
+      for (size_t i = 0; i < n; i++) {
+        MPInt rnd;
+        MPInt::RandomLtN(order, &rnd);
+        proofs.emplace_back(composition.ProveOr(
+            value.GetBit(i), {blindings[i]}, statements[i], {rnd}, ""));
+      }
+      return proofs;
+    };
+    auto proofs = prove_bits();
+    for (auto _ : state) {
+      if (prove) {
+        prove_bits();
+      } else {
+        ec_->PointEqual(ec_->MultiScalarMul(bit_commitments, powers),
+                        commitment);
+        for (size_t i = 0; i < n; i++) {
+          composition.VerifyOr(statements[i], proofs[i], "");
+        }
+      }
+    }
+  }
+
+  void BenchHashToScalar(benchmark::State& state, HashAlgorithm hash) {
+    std::vector<uint8_t> data(state.range(), 0xab);
+    const auto& order = ec_->GetOrder();
+    for (auto _ : state) {
+      Transcript transcript(hash);
+      transcript.Absorb(data);
+      benchmark::DoNotOptimize(transcript.ChallengeScalar(order));
+    }
+  }
+
+  void BenchAggregated(benchmark::State& state, bool aggregated,
+                       bool prove) {
+    const size_t n = state.range();
+    const auto& order = ec_->GetOrder();
+    std::vector<EcPoint> generators = {ec_->GetGenerator()};
+    MPInt tmp;
+    MPInt::RandomLtN(order, &tmp);
+    generators.emplace_back(ec_->MulBase(tmp));
+    SigmaProtocol protocol(ec_, generators, {SigmaType::DlogEq, 1, 2, 2});
+    std::vector<std::vector<MPInt>> witnesses(n, std::vector<MPInt>(1));
+    std::vector<std::vector<MPInt>> rnd_witnesses(n, std::vector<MPInt>(1));
+    std::vector<std::vector<EcPoint>> statements;
+    for (size_t i = 0; i < n; i++) {
+      MPInt::RandomLtN(order, &witnesses[i][0]);
+      MPInt::RandomLtN(order, &rnd_witnesses[i][0]);
+      statements.emplace_back(protocol.ToStatement(witnesses[i]));
+    }
+    std::vector<ByteContainerView> other_infos(n);
+
+    if (aggregated) {
+      auto proof = protocol.ProveAggregated(witnesses, statements,
+                                            rnd_witnesses, "");
+      state.counters["proof_bytes"] = proof.Serialize(*ec_).size();
+      for (auto _ : state) {
+        if (prove) {
+          protocol.ProveAggregated(witnesses, statements, rnd_witnesses, "");
+        } else {
+          protocol.VerifyAggregated(statements, proof, "");
+        }
+      }
+      return;
+    }
+
+    auto proofs = protocol.ProveShortMany(witnesses, statements,
+                                          rnd_witnesses, other_infos);
+    size_t proof_bytes = 0;
+    for (const auto& proof : proofs) {
+      proof_bytes += proof.Serialize(*ec_).size();
+    }
+    state.counters["proof_bytes"] = proof_bytes;
+    for (auto _ : state) {
+      if (prove) {
+        protocol.ProveShortMany(witnesses, statements, rnd_witnesses,
+                                other_infos);
+      } else {
+        protocol.VerifyShortMany(statements, proofs, other_infos);
+      }
+    }
+  }
+
+  void BenchShuffle(benchmark::State& state, bool prove) {
+    const size_t n = state.range();
+    const auto& order = ec_->GetOrder();
+    MPInt sk;
+    MPInt::RandomLtN(order, &sk);
+    EcPoint pk = ec_->MulBase(sk);
+    std::unique_ptr<ShuffleProtocol> protocol_ptr;
+    try {
+      protocol_ptr =
+          std::make_unique<ShuffleProtocol>(ec_, ec_->GetGenerator(), pk, n);
+    } catch (const yacl::Exception& e) {
+      // generators are derived by HashToCurve, which not all libs support
+      state.SkipWithError(e.what());
+      return;
+    }
+    const auto& protocol = *protocol_ptr;
+
+    // The content of inputs does not matter, so they are made by additions
+    // to keep the setup fast
+    std::vector<ElGamalCiphertext> inputs(n);
+    std::vector<size_t> permutation(n);
+    std::vector<MPInt> randomness(n);
+    MPInt tmp;
+    MPInt::RandomLtN(order, &tmp);
+    inputs[0] = {ec_->MulBase(tmp), ec_->Mul(pk, tmp)};
+    for (size_t i = 0; i < n; i++) {
+      if (i > 0) {
+        inputs[i] = {ec_->Add(inputs[i - 1].c1, ec_->GetGenerator()),
+                     ec_->Add(inputs[i - 1].c2, pk)};
+      }
+      permutation[i] = n - 1 - i;
+      MPInt::RandomLtN(order, &randomness[i]);
+    }
+    auto outputs = protocol.Shuffle(inputs, permutation, randomness);
+    auto proof = protocol.Prove(inputs, outputs, permutation, randomness, "");
+    for (auto _ : state) {
+      if (prove) {
+        protocol.Prove(inputs, outputs, permutation, randomness, "");
+      } else {
+        protocol.Verify(inputs, outputs, proof, "");
+      }
+    }
+  }
+
+  void BenchSigma(benchmark::State& state, SigmaType type, SigmaOp op,
+                  HashAlgorithm hash) {
+    SigmaMeta meta = GetMeta(type, state.range());
+    std::vector<EcPoint> generators;
+    std::vector<MPInt> witness(meta.num_witness);
+    std::vector<MPInt> rnd_witness(meta.num_witness);
+    MPInt tmp;
+    for (uint32_t i = 0; i < meta.num_generator; i++) {
+      MPInt::RandomLtN(ec_->GetOrder(), &tmp);
+      generators.emplace_back(ec_->MulBase(tmp));
+    }
+    for (uint32_t i = 0; i < meta.num_witness; i++) {
+      MPInt::RandomLtN(ec_->GetOrder(), &witness[i]);
+      MPInt::RandomLtN(ec_->GetOrder(), &rnd_witness[i]);
+    }
+
+    SigmaProtocol protocol(ec_, generators, meta, hash);
+    // re-encrypt a random ciphertext for ElGamalReEnc
+    auto to_statement = [&] {
+      if (type != SigmaType::ElGamalReEnc) {
+        return protocol.ToStatement(witness);
+      }
+      return protocol.ToReEncStatement(witness[0], generators[0],
+                                       generators[1]);
+    };
+    auto statement = to_statement();
+    auto batch = protocol.ProveBatch(witness, statement, rnd_witness, "");
+    auto short_proof = protocol.ProveShort(witness, statement, rnd_witness, "");
+    auto prefix =
+        internal::CreateSigmaTranscriptPrefix(*ec_, generators, meta, hash);
+    for (auto _ : state) {
+      switch (op) {
+        case SigmaOp::ToStatement:
+          benchmark::DoNotOptimize(to_statement());
+          break;
+        case SigmaOp::ProveBatch:
+          benchmark::DoNotOptimize(
+              protocol.ProveBatch(witness, statement, rnd_witness, ""));
+          break;
+        case SigmaOp::VerifyBatch:
+          benchmark::DoNotOptimize(protocol.VerifyBatch(statement, batch, ""));
+          break;
+        case SigmaOp::ProveShort:
+          benchmark::DoNotOptimize(
+              protocol.ProveShort(witness, statement, rnd_witness, ""));
+          break;
+        case SigmaOp::VerifyShort:
+          benchmark::DoNotOptimize(
+              protocol.VerifyShort(statement, short_proof, ""));
+          break;
+        case SigmaOp::GetChallenge:
+          benchmark::DoNotOptimize(internal::GetSigmaChallenge(
+              prefix, *ec_, statement, batch.rnd_statement, ""));
+          break;
+      }
+    }
+  }
+
+  void BenchPedersenMult(benchmark::State& state, bool prove) {
+    std::vector<EcPoint> generators;
+    std::vector<MPInt> witness(5);
+    std::vector<MPInt> rnd_witness(5);
+    for (size_t i = 0; i < 5; i++) {
+      MPInt::RandomLtN(ec_->GetOrder(), &witness[i]);
+      MPInt::RandomLtN(ec_->GetOrder(), &rnd_witness[i]);
+      generators.emplace_back(ec_->MulBase(witness[i]));
+    }
+
+    if (state.range() == 2) {
+      SigmaProtocol protocol(ec_, generators, {SigmaType::Pedersen, 2, 2, 1});
+      std::vector<MPInt> w = {witness[0], witness[1]};
+      auto statement = protocol.ToStatement(w);
+      auto proof = protocol.ProveShort(w, statement, w, "");
+      for (auto _ : state) {
+        for (size_t i = 0; i < 3; i++) {
+          if (prove) {
+            protocol.ProveShort(w, statement, w, "");
+          } else {
+            protocol.VerifyShort(statement, proof, "");
+          }
+        }
+      }
+      return;
+    }
+
+    auto type = state.range() == 0 ? SigmaType::PedersenMult
+                                   : SigmaType::PedersenMultOpenOne;
+    SigmaProtocol protocol(ec_, generators, {type, 5, 2, 3});
+    auto statement = protocol.ToStatement(witness);
+    auto proof = protocol.ProveShort(witness, statement, rnd_witness, "");
+    for (auto _ : state) {
+      if (prove) {
+        protocol.ProveShort(witness, statement, rnd_witness, "");
+      } else {
+        protocol.VerifyShort(statement, proof, "");
+      }
+    }
+  }
+
+  // A SeveralDlog proof with n scalars and n points
+  SigmaNIBatchProof MakeBatchProof(size_t n) const {
+    SigmaNIBatchProof proof{SigmaType::SeveralDlog, {}, {}};
+    for (size_t i = 0; i < n; i++) {
+      proof.proof.emplace_back();
+      MPInt::RandomLtN(ec_->GetOrder(), &proof.proof.back());
+      proof.rnd_statement.emplace_back(ec_->MulBase(proof.proof.back()));
+    }
+    return proof;
+  }
+
+  void BenchSerializeBatchProof(benchmark::State& state) {
+    auto proof = MakeBatchProof(state.range());
+    Buffer buf;
+    for (auto _ : state) {
+      proof.Serialize(*ec_, &buf);
+    }
+    state.counters["bytes"] = buf.size();
+  }
+
+  void BenchDeserializeBatchProof(benchmark::State& state) {
+    auto buf = MakeBatchProof(state.range()).Serialize(*ec_);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(SigmaNIBatchProofView(*ec_, buf).ToProof());
+    }
+  }
+
+  void BenchSerializeShortProof(benchmark::State& state) {
+    auto batch = MakeBatchProof(state.range());
+    SigmaNIShortProof proof{batch.type, batch.proof, batch.proof[0]};
+    Buffer buf;
+    for (auto _ : state) {
+      proof.Serialize(*ec_, &buf);
+    }
+    state.counters["bytes"] = buf.size();
+  }
+
+  void BenchDeserializeShortProof(benchmark::State& state) {
+    auto batch = MakeBatchProof(state.range());
+    SigmaNIShortProof proof{batch.type, batch.proof, batch.proof[0]};
+    auto buf = proof.Serialize(*ec_);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(SigmaNIShortProofView(*ec_, buf).ToProof());
+    }
+  }
+
+ private:
+  std::unique_ptr<EcGroup> ec_;
+};
+
+void InitAndRunBenchmarks() {
+  static std::vector<SigmaBencher> benchers;
+  std::vector<std::string> curves = absl::StrSplit(
+      FLAGS_curve, absl::ByAnyChar(";,.|&+"), absl::SkipWhitespace());
+  for (const std::string& curve : curves) {
+    if (!FLAGS_lib.empty()) {
+      benchers.emplace_back(EcGroupFactory::Create(curve, FLAGS_lib));
+      continue;
+    }
+
+    for (const auto& lib : EcGroupFactory::ListEcLibraries(curve)) {
+      benchers.emplace_back(EcGroupFactory::Create(curve, lib));
+    }
+  }
+
+  for (auto& bencher : benchers) {
+    bencher.Register();
+  }
+}
+
+}  // namespace yacl::crypto::bench
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  benchmark::Initialize(&argc, argv);
+  yacl::crypto::bench::InitAndRunBenchmarks();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,132 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/precomputed_generators.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace yacl::crypto {
+
+namespace {
+
+// The construction order of global static variables is not fixed, so we wrap
+// the cache within a function to ensure it is constructed before accessing.
+struct GCache {
+  static auto& Mutex() {
+    static std::mutex kMutex;
+    return kMutex;
+  }
+
+  static auto& Tables() {
+    static std::map<std::string, std::weak_ptr<const PrecomputedGenerators>>
+        kTables;
+    return kTables;
+  }
+
+  // Drop entries whose tables have been freed, the caller holds the lock
+  static void Purge() {
+    auto& tables = Tables();
+    for (auto it = tables.begin(); it != tables.end();) {
+      if (it->second.expired()) {
+        it = tables.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+PrecomputedGenerators::PrecomputedGenerators(
+    const EcGroup& group, absl::Span<const EcPoint> generators,
+    size_t window_bits)
+    : window_bits_(window_bits) {
+  tables_.reserve(generators.size());
+  for (const auto& generator : generators) {
+    tables_.emplace_back(group.CreateFixedBaseTable(generator, window_bits_));
+  }
+}
+
+std::shared_ptr<const PrecomputedGenerators>
+PrecomputedGenerators::GetOrCreate(const EcGroup& group,
+                                   absl::Span<const EcPoint> generators,
+                                   size_t window_bits) {
+  auto key = fmt::format("{}/{}/{}/{}/", group.GetLibraryName(),
+                         group.GetCurveName(), window_bits, generators.size());
+  for (const auto& generator : generators) {
+    auto buf = group.SerializePoint(generator);
+    key.append(buf.data<char>(), buf.size());
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(GCache::Mutex());
+    auto it = GCache::Tables().find(key);
+    if (it != GCache::Tables().end()) {
+      if (auto tables = it->second.lock()) {
+        return tables;
+      }
+    }
+  }
+
+  // Build tables without holding the lock, if another thread wins the race,
+  // just use its tables.
+  auto tables = std::make_shared<const PrecomputedGenerators>(group, generators,
+                                                              window_bits);
+  std::lock_guard<std::mutex> guard(GCache::Mutex());
+  auto& entry = GCache::Tables()[key];
+  if (auto winner = entry.lock()) {
+    return winner;
+  }
+  entry = tables;
+  GCache::Purge();
+  return tables;
+}
+
+void PrecomputedGenerators::ClearCache() {
+  std::lock_guard<std::mutex> guard(GCache::Mutex());
+  GCache::Tables().clear();
+}
+
+size_t PrecomputedGenerators::CacheSize() {
+  std::lock_guard<std::mutex> guard(GCache::Mutex());
+  return GCache::Tables().size();
+}
+
+EcPoint PrecomputedGenerators::Mul(const EcGroup& group, size_t idx,
+                                   const MPInt& scalar) const {
+  YACL_ENFORCE(idx < tables_.size(), "generator index {} out of range {}", idx,
+               tables_.size());
+  return group.MulFixedBase(*tables_[idx], scalar);
+}
+
+EcPoint PrecomputedGenerators::MultiScalarMul(
+    const EcGroup& group, absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(scalars.size() <= tables_.size(),
+               "too many scalars, #scalars={}, #generators={}", scalars.size(),
+               tables_.size());
+
+  if (scalars.empty()) {
+    return group.MulBase(0_mp);
+  }
+  auto res = group.MulFixedBase(*tables_[0], scalars[0]);
+  for (size_t i = 1; i < scalars.size(); ++i) {
+    group.AddInplace(&res, group.MulFixedBase(*tables_[i], scalars[i]));
+  }
+  return res;
+}
+
+}  // namespace yacl::crypto
@@ -0,0 +1,74 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+
+namespace yacl::crypto {
+
+// Fixed-base tables for a list of generators, one
+// EcGroup::CreateFixedBaseTable() per generator.
+//
+// With the generic windowed tables and window size w, a multiplication by a
+// k-bit scalar only costs ceil(k/w) point additions and no doubling, and each
+// generator takes ceil(k/w) * (2^w - 1) points of memory, i.e. 960 points for
+// a 256-bit curve with w = 4. Libs may use their own tables instead, e.g.
+// OpenSSL reuses its precomputation of G.
+//
+// Generators must lie in the prime-order subgroup.
+//
+// The tables hold no reference to the EcGroup instance which built them, so
+// they can be shared by every group instance of the same curve and library.
+class PrecomputedGenerators {
+ public:
+  static constexpr size_t kDefaultWindowBits =
+      FixedBaseTable::kDefaultWindowBits;
+
+  PrecomputedGenerators(const EcGroup& group,
+                        absl::Span<const EcPoint> generators,
+                        size_t window_bits = kDefaultWindowBits);
+
+  // Get tables from a process-wide cache keyed on curve, library, window size
+  // and generators. Tables are built on first use. The cache only holds weak
+  // references, so tables are freed once the last caller drops them, and
+  // relations whose generators change per instance do not pile up tables.
+  static std::shared_ptr<const PrecomputedGenerators> GetOrCreate(
+      const EcGroup& group, absl::Span<const EcPoint> generators,
+      size_t window_bits = kDefaultWindowBits);
+  // Forget all cached tables, tables in use are not affected
+  static void ClearCache();
+  // Number of cache entries, for tests
+  static size_t CacheSize();
+
+  size_t Size() const { return tables_.size(); }
+  size_t WindowBits() const { return window_bits_; }
+
+  // Returns: generators[idx] * scalar
+  EcPoint Mul(const EcGroup& group, size_t idx, const MPInt& scalar) const;
+  // Returns: generators[0] * scalars[0] + ... + generators[n] * scalars[n]
+  EcPoint MultiScalarMul(const EcGroup& group,
+                         absl::Span<const MPInt> scalars) const;
+
+ private:
+  size_t window_bits_;
+  std::vector<std::shared_ptr<const FixedBaseTable>> tables_;
+};
+
+}  // namespace yacl::crypto
@@ -0,0 +1,427 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/range_proof.h"
+
+#include <utility>
+
+namespace yacl::crypto {
+
+namespace {
+
+bool IsPowerOfTwo(size_t x) { return x != 0 && (x & (x - 1)) == 0; }
+
+size_t Log2(size_t x) {
+  size_t ret = 0;
+  while ((size_t{1} << ret) < x) {
+    ret++;
+  }
+  return ret;
+}
+
+// the random weight of the t(x) check in verification
+constexpr size_t kCheckWeightBits = 128;
+
+}  // namespace
+
+RangeProtocol::RangeProtocol(const std::unique_ptr<EcGroup>& group,
+                             const EcPoint& g, const EcPoint& h, size_t bits,
+                             size_t max_aggregation, HashAlgorithm hash)
+    : group_ref_(group),
+      g_(g),
+      h_(h),
+      bits_(bits),
+      max_aggregation_(max_aggregation),
+      order_(group->GetOrder()),
+      scalar_bytes_((order_.BitCount() + 7) / 8),
+      transcript_prefix_(hash) {
+  YACL_ENFORCE(IsPowerOfTwo(bits_) && bits_ <= kMaxBits,
+               "bits must be a power of 2 up to {}, got {}", kMaxBits, bits_);
+  YACL_ENFORCE(IsPowerOfTwo(max_aggregation_),
+               "max_aggregation must be a power of 2, got {}",
+               max_aggregation_);
+
+  size_t num = bits_ * max_aggregation_;
+  gens_g_.reserve(num);
+  gens_h_.reserve(num);
+  for (size_t i = 0; i < num; i++) {
+    gens_g_.emplace_back(group_ref_->HashToCurve(
+        HashToCurveStrategy::TryAndRehash_SHA2,
+        fmt::format("yacl/RangeProtocol/G/{}", i)));
+    gens_h_.emplace_back(group_ref_->HashToCurve(
+        HashToCurveStrategy::TryAndRehash_SHA2,
+        fmt::format("yacl/RangeProtocol/H/{}", i)));
+  }
+
+  transcript_prefix_.Absorb(
+      fmt::format("RangeProtocol/{}/{}", bits_, max_aggregation_));
+  transcript_prefix_.AbsorbPoint(*group_ref_, g_);
+  transcript_prefix_.AbsorbPoint(*group_ref_, h_);
+}
+
+EcPoint RangeProtocol::Commit(const MPInt& value,
+                              const MPInt& blinding) const {
+  return group_ref_->MultiScalarMul({g_, h_}, {value, blinding});
+}
+
+RangeNIProof RangeProtocol::Prove(const std::vector<MPInt>& values,
+                                  const std::vector<MPInt>& blindings,
+                                  ByteContainerView other_info) const {
+  const size_t n = bits_;
+  const size_t m = values.size();
+  const size_t nm = n * m;
+  YACL_ENFORCE(IsPowerOfTwo(m) && m <= max_aggregation_,
+               "number of values must be a power of 2 up to {}, got {}",
+               max_aggregation_, m);
+  YACL_ENFORCE(blindings.size() == m, "#values={}, #blindings={}", m,
+               blindings.size());
+
+  std::vector<EcPoint> commitments;
+  commitments.reserve(m);
+  for (size_t j = 0; j < m; j++) {
+    YACL_ENFORCE(!values[j].IsNegative() && values[j].BitCount() <= n,
+                 "value {} is out of range", j);
+    commitments.emplace_back(Commit(values[j], blindings[j]));
+  }
+  Transcript transcript = StartTranscript(commitments, other_info);
+  RangeNIProof proof;
+  auto random_scalar = [&] {
+    MPInt s;
+    MPInt::RandomLtN(order_, &s);
+    return s;
+  };
+  auto mul = [&](const MPInt& a, const MPInt& b) {
+    return a.MulMod(b, order_);
+  };
+  auto add = [&](const MPInt& a, const MPInt& b) {
+    return a.AddMod(b, order_);
+  };
+  auto inner_product = [&](absl::Span<const MPInt> a,
+                           absl::Span<const MPInt> b) {
+    MPInt res = 0_mp;
+    for (size_t i = 0; i < a.size(); i++) {
+      res += a[i] * b[i];
+    }
+    return res % order_;
+  };
+
+  // A = h^alpha·G^a_L·H^a_R, where a_L are bits of values & a_R = a_L - 1
+  std::vector<MPInt> a_l(nm);
+  std::vector<MPInt> a_r(nm);
+  for (size_t i = 0; i < nm; i++) {
+    a_l[i] = MPInt(values[i / n].GetBit(i % n));
+    a_r[i] = a_l[i] - 1_mp;
+  }
+  MPInt alpha = random_scalar();
+  std::vector<EcPoint> points(gens_g_.begin(), gens_g_.begin() + nm);
+  points.insert(points.end(), gens_h_.begin(), gens_h_.begin() + nm);
+  points.emplace_back(h_);
+  std::vector<MPInt> scalars(a_l);
+  scalars.insert(scalars.end(), a_r.begin(), a_r.end());
+  scalars.emplace_back(alpha);
+  proof.A = group_ref_->MultiScalarMul(points, scalars);
+
+  // S = h^rho·G^s_L·H^s_R
+  MPInt rho = random_scalar();
+  std::vector<MPInt> s_l(nm);
+  std::vector<MPInt> s_r(nm);
+  for (size_t i = 0; i < nm; i++) {
+    s_l[i] = random_scalar();
+    s_r[i] = random_scalar();
+    scalars[i] = s_l[i];
+    scalars[nm + i] = s_r[i];
+  }
+  scalars[2 * nm] = rho;
+  proof.S = group_ref_->MultiScalarMul(points, scalars);
+
+  transcript.AbsorbPoint(*group_ref_, proof.A);
+  transcript.AbsorbPoint(*group_ref_, proof.S);
+  MPInt y = Challenge("y", &transcript);
+  MPInt z = Challenge("z", &transcript);
+
+  // l(X) = l0 + l1·X, r(X) = r0 + r1·X, and t(X) = <l(X), r(X)>, where
+  //   l0 = a_L - z,  l1 = s_L
+  //   r0 = y^nm ∘ (a_R + z) + z^(2+j)·2^n,  r1 = y^nm ∘ s_R
+  std::vector<MPInt> l0(nm);
+  std::vector<MPInt> r0(nm);
+  std::vector<MPInt> r1(nm);
+  MPInt y_pow = 1_mp;
+  MPInt z_pow = mul(z, z);
+  for (size_t i = 0; i < nm; i++) {
+    if (i > 0 && i % n == 0) {
+      z_pow = mul(z_pow, z);
+    }
+    l0[i] = (a_l[i] - z) % order_;
+    r0[i] = add(mul(y_pow, a_r[i] + z), mul(z_pow, MPInt(1) << (i % n)));
+    r1[i] = mul(y_pow, s_r[i]);
+    y_pow = mul(y_pow, y);
+  }
+  MPInt t1 = add(inner_product(l0, r1), inner_product(s_l, r0));
+  MPInt t2 = inner_product(s_l, r1);
+  MPInt tau1 = random_scalar();
+  MPInt tau2 = random_scalar();
+  proof.T1 = Commit(t1, tau1);
+  proof.T2 = Commit(t2, tau2);
+
+  transcript.AbsorbPoint(*group_ref_, proof.T1);
+  transcript.AbsorbPoint(*group_ref_, proof.T2);
+  MPInt x = Challenge("x", &transcript);
+
+  // tau_x = tau2·x^2 + tau1·x + sum_j z^(2+j)·gamma_j
+  proof.tau_x = add(mul(tau2, mul(x, x)), mul(tau1, x));
+  z_pow = mul(z, z);
+  for (size_t j = 0; j < m; j++) {
+    proof.tau_x = add(proof.tau_x, mul(z_pow, blindings[j]));
+    z_pow = mul(z_pow, z);
+  }
+  proof.mu = add(alpha, mul(rho, x));
+  std::vector<MPInt> l(nm);
+  std::vector<MPInt> r(nm);
+  for (size_t i = 0; i < nm; i++) {
+    l[i] = add(l0[i], mul(s_l[i], x));
+    r[i] = add(r0[i], mul(r1[i], x));
+  }
+  proof.t_hat = inner_product(l, r);
+
+  AbsorbScalar(proof.tau_x, &transcript);
+  AbsorbScalar(proof.mu, &transcript);
+  AbsorbScalar(proof.t_hat, &transcript);
+  EcPoint q = group_ref_->Mul(g_, Challenge("w", &transcript));
+
+  // Inner product argument of <l, r> = t_hat over generators G & H', where
+  // H'_i = H_i^(y^-i). Factors y^-i are applied while folding generators in
+  // the first round, so H' is never computed.
+  std::vector<EcPoint> gens_g(gens_g_.begin(), gens_g_.begin() + nm);
+  std::vector<EcPoint> gens_h(gens_h_.begin(), gens_h_.begin() + nm);
+  std::vector<MPInt> h_factors(nm);
+  MPInt y_inv = y.InvertMod(order_);
+  h_factors[0] = 1_mp;
+  for (size_t i = 1; i < nm; i++) {
+    h_factors[i] = mul(h_factors[i - 1], y_inv);
+  }
+  for (size_t k = nm / 2; k >= 1; k /= 2) {
+    MPInt c_l = inner_product(absl::MakeConstSpan(l).subspan(0, k),
+                              absl::MakeConstSpan(r).subspan(k, k));
+    MPInt c_r = inner_product(absl::MakeConstSpan(l).subspan(k, k),
+                              absl::MakeConstSpan(r).subspan(0, k));
+    // L = G_hi^l_lo·H_lo^r_hi·Q^c_L, R = G_lo^l_hi·H_hi^r_lo·Q^c_R
+    std::vector<EcPoint> l_points;
+    std::vector<MPInt> l_scalars;
+    std::vector<EcPoint> r_points;
+    std::vector<MPInt> r_scalars;
+    for (size_t i = 0; i < k; i++) {
+      l_points.emplace_back(gens_g[k + i]);
+      l_scalars.emplace_back(l[i]);
+      l_points.emplace_back(gens_h[i]);
+      l_scalars.emplace_back(mul(r[k + i], h_factors[i]));
+      r_points.emplace_back(gens_g[i]);
+      r_scalars.emplace_back(l[k + i]);
+      r_points.emplace_back(gens_h[k + i]);
+      r_scalars.emplace_back(mul(r[i], h_factors[k + i]));
+    }
+    l_points.emplace_back(q);
+    l_scalars.emplace_back(std::move(c_l));
+    r_points.emplace_back(q);
+    r_scalars.emplace_back(std::move(c_r));
+    proof.L.emplace_back(group_ref_->MultiScalarMul(l_points, l_scalars));
+    proof.R.emplace_back(group_ref_->MultiScalarMul(r_points, r_scalars));
+
+    transcript.AbsorbPoint(*group_ref_, proof.L.back());
+    transcript.AbsorbPoint(*group_ref_, proof.R.back());
+    MPInt u = Challenge("u", &transcript);
+    MPInt u_inv = u.InvertMod(order_);
+    for (size_t i = 0; i < k; i++) {
+      l[i] = add(mul(l[i], u), mul(l[k + i], u_inv));
+      r[i] = add(mul(r[i], u_inv), mul(r[k + i], u));
+      if (k > 1) {
+        gens_g[i] =
+            group_ref_->MultiScalarMul({gens_g[i], gens_g[k + i]}, {u_inv, u});
+        gens_h[i] = group_ref_->MultiScalarMul(
+            {gens_h[i], gens_h[k + i]},
+            {mul(u, h_factors[i]), mul(u_inv, h_factors[k + i])});
+        h_factors[i] = 1_mp;
+      }
+    }
+    l.resize(k);
+    r.resize(k);
+    gens_g.resize(k);
+    gens_h.resize(k);
+    h_factors.resize(k);
+  }
+  proof.a = std::move(l[0]);
+  proof.b = std::move(r[0]);
+  return proof;
+}
+
+bool RangeProtocol::Verify(const std::vector<EcPoint>& commitments,
+                           const RangeNIProof& proof,
+                           ByteContainerView other_info) const {
+  const size_t n = bits_;
+  const size_t m = commitments.size();
+  const size_t nm = n * m;
+  const size_t rounds = Log2(nm);
+  if (!IsPowerOfTwo(m) || m > max_aggregation_ || proof.L.size() != rounds ||
+      proof.R.size() != rounds) {
+    return false;
+  }
+  for (const auto* s : {&proof.tau_x, &proof.mu, &proof.t_hat, &proof.a,
+                        &proof.b}) {
+    if (s->IsNegative() || *s >= order_) {
+      return false;
+    }
+  }
+  // all points come from the prover, check them in one batch before hashing
+  std::vector<EcPoint> proof_points(commitments);
+  proof_points.reserve(m + 4 + 2 * rounds);
+  proof_points.insert(proof_points.end(),
+                      {proof.A, proof.S, proof.T1, proof.T2});
+  proof_points.insert(proof_points.end(), proof.L.begin(), proof.L.end());
+  proof_points.insert(proof_points.end(), proof.R.begin(), proof.R.end());
+  if (!group_ref_->IsInCurveGroup(proof_points)) {
+    return false;
+  }
+  auto mul = [&](const MPInt& a, const MPInt& b) {
+    return a.MulMod(b, order_);
+  };
+  auto add = [&](const MPInt& a, const MPInt& b) {
+    return a.AddMod(b, order_);
+  };
+  auto sub = [&](const MPInt& a, const MPInt& b) {
+    return a.SubMod(b, order_);
+  };
+
+  Transcript transcript = StartTranscript(commitments, other_info);
+  transcript.AbsorbPoint(*group_ref_, proof.A);
+  transcript.AbsorbPoint(*group_ref_, proof.S);
+  MPInt y = Challenge("y", &transcript);
+  MPInt z = Challenge("z", &transcript);
+  transcript.AbsorbPoint(*group_ref_, proof.T1);
+  transcript.AbsorbPoint(*group_ref_, proof.T2);
+  MPInt x = Challenge("x", &transcript);
+  AbsorbScalar(proof.tau_x, &transcript);
+  AbsorbScalar(proof.mu, &transcript);
+  AbsorbScalar(proof.t_hat, &transcript);
+  MPInt w = Challenge("w", &transcript);
+  std::vector<MPInt> u_sq(rounds);
+  std::vector<MPInt> u_inv_sq(rounds);
+  MPInt u_inv_prod = 1_mp;
+  for (size_t k = 0; k < rounds; k++) {
+    transcript.AbsorbPoint(*group_ref_, proof.L[k]);
+    transcript.AbsorbPoint(*group_ref_, proof.R[k]);
+    MPInt u = Challenge("u", &transcript);
+    MPInt u_inv = u.InvertMod(order_);
+    u_sq[k] = mul(u, u);
+    u_inv_sq[k] = mul(u_inv, u_inv);
+    u_inv_prod = mul(u_inv_prod, u_inv);
+  }
+
+  // s_i = prod_k u_k^(+1 or -1, by the (rounds-1-k)-th bit of i), which is
+  // the coefficient of G_i in the folded generator
+  std::vector<MPInt> s(nm);
+  s[0] = u_inv_prod;
+  for (size_t i = 1; i < nm; i++) {
+    size_t lg = Log2(i + 1) - 1;  // floor(log2(i))
+    size_t k = size_t{1} << lg;
+    s[i] = mul(s[i - k], u_sq[rounds - 1 - lg]);
+  }
+
+  // The following equations are checked by one multi-scalar multiplication,
+  // where the t(x) check is weighted by a random c:
+  //   g^t_hat·h^tau_x == V^(z^2·z^j)·g^delta(y,z)·T1^x·T2^(x^2)
+  //   A·S^x·L^(u^2)·R^(u^-2)·h^-mu·g^(w·(t_hat-a·b))
+  //     == G^(z+a·s)·H^(-z-y^-i·(z^(2+j)·2^i-b·s_inv))
+  MPInt c;
+  MPInt::RandomExactBits(kCheckWeightBits, &c);
+  std::vector<EcPoint> points;
+  std::vector<MPInt> scalars;
+  points.reserve(2 * nm + 2 * rounds + m + 6);
+  scalars.reserve(points.capacity());
+  auto add_term = [&](const EcPoint& p, MPInt scalar) {
+    points.emplace_back(p);
+    scalars.emplace_back(std::move(scalar));
+  };
+  add_term(proof.A, 1_mp);
+  add_term(proof.S, x);
+  add_term(proof.T1, mul(c, x));
+  add_term(proof.T2, mul(c, mul(x, x)));
+  for (size_t k = 0; k < rounds; k++) {
+    add_term(proof.L[k], u_sq[k]);
+    add_term(proof.R[k], u_inv_sq[k]);
+  }
+  add_term(h_, sub(0_mp, add(proof.mu, mul(c, proof.tau_x))));
+
+  // delta(y, z) = (z - z^2)·<1, y^nm> - sum_j z^(3+j)·<1, 2^n>
+  MPInt zz = mul(z, z);
+  MPInt y_sum = 0_mp;
+  MPInt y_pow = 1_mp;
+  for (size_t i = 0; i < nm; i++) {
+    y_sum = add(y_sum, y_pow);
+    y_pow = mul(y_pow, y);
+  }
+  MPInt two_sum = (MPInt(1) << n) - 1_mp;
+  MPInt delta = mul(sub(z, zz), y_sum);
+  MPInt z_pow = mul(zz, z);
+  for (size_t j = 0; j < m; j++) {
+    delta = sub(delta, mul(z_pow, two_sum));
+    z_pow = mul(z_pow, z);
+  }
+  add_term(g_, add(mul(w, sub(proof.t_hat, mul(proof.a, proof.b))),
+                   mul(c, sub(delta, proof.t_hat))));
+
+  MPInt neg_z = sub(0_mp, z);
+  MPInt y_inv = y.InvertMod(order_);
+  MPInt y_inv_pow = 1_mp;
+  z_pow = zz;
+  for (size_t i = 0; i < nm; i++) {
+    add_term(gens_g_[i], sub(neg_z, mul(proof.a, s[i])));
+  }
+  for (size_t i = 0; i < nm; i++) {
+    if (i > 0 && i % n == 0) {
+      z_pow = mul(z_pow, z);
+    }
+    MPInt z_and_2 = mul(z_pow, MPInt(1) << (i % n));
+    add_term(gens_h_[i],
+             add(z, mul(y_inv_pow, sub(z_and_2, mul(proof.b, s[nm - 1 - i])))));
+    y_inv_pow = mul(y_inv_pow, y_inv);
+  }
+  z_pow = mul(c, zz);
+  for (size_t j = 0; j < m; j++) {
+    add_term(commitments[j], z_pow);
+    z_pow = mul(z_pow, z);
+  }
+  return group_ref_->IsInfinity(group_ref_->MultiScalarMul(points, scalars));
+}
+
+Transcript RangeProtocol::StartTranscript(
+    const std::vector<EcPoint>& commitments,
+    ByteContainerView other_info) const {
+  Transcript transcript(transcript_prefix_);
+  transcript.Absorb(fmt::format("{}", commitments.size()));
+  transcript.AbsorbPoints(*group_ref_, commitments);
+  transcript.Absorb(other_info);
+  return transcript;
+}
+
+void RangeProtocol::AbsorbScalar(const MPInt& s,
+                                 Transcript* transcript) const {
+  transcript->Absorb(s.ToBytes(scalar_bytes_, Endian::little));
+}
+
+MPInt RangeProtocol::Challenge(std::string_view label,
+                               Transcript* transcript) const {
+  transcript->Absorb(label);
+  return transcript->ChallengeScalar(order_);
+}
+
+}  // namespace yacl::crypto
@@ -0,0 +1,95 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+#include "yacl/crypto/primitives/zkp/transcript.h"
+
+// Bulletproofs range proofs, see https://eprint.iacr.org/2017/1066
+//
+// Prove that Pedersen commitments V_j = g^v_j·h^gamma_j (the same commitment
+// as SigmaType::Pedersen with generators {g, h}) hide values in [0, 2^n), by
+// 2·log2(n·m) + 4 points and 5 scalars for m aggregated values. The verifier
+// checks the whole proof by one multi-scalar multiplication of
+// 2·n·m + 2·log2(n·m) + m + 6 points.
+
+namespace yacl::crypto {
+
+struct RangeNIProof {
+  EcPoint A;   // commitment to the bits of values
+  EcPoint S;   // commitment to the blinding vectors
+  EcPoint T1;  // commitments to the coefficients of t(X)
+  EcPoint T2;
+  MPInt tau_x;  // blinding of t(x)
+  MPInt mu;     // blinding of A & S
+  MPInt t_hat;  // t(x)
+  // inner product argument
+  std::vector<EcPoint> L;
+  std::vector<EcPoint> R;
+  MPInt a;
+  MPInt b;
+};
+
+class RangeProtocol {
+ public:
+  static constexpr size_t kMaxBits = 64;
+
+  // The vector generators are derived by hashing to the curve, so nobody knows
+  // their discrete logarithms. bits must be a power of 2 up to kMaxBits, and
+  // proofs could aggregate up to max_aggregation (a power of 2) values.
+  RangeProtocol(const std::unique_ptr<EcGroup>& group, const EcPoint& g,
+                const EcPoint& h, size_t bits = kMaxBits,
+                size_t max_aggregation = 1,
+                HashAlgorithm hash = HashAlgorithm::SHA256);
+
+  size_t Bits() const { return bits_; }
+
+  // Returns: g^value·h^blinding
+  EcPoint Commit(const MPInt& value, const MPInt& blinding) const;
+
+  // Prove that Commit(values[j], blindings[j]) hide values in [0, 2^bits).
+  // The number of values must be a power of 2 up to max_aggregation.
+  RangeNIProof Prove(const std::vector<MPInt>& values,
+                     const std::vector<MPInt>& blindings,
+                     ByteContainerView other_info) const;
+  bool Verify(const std::vector<EcPoint>& commitments,
+              const RangeNIProof& proof, ByteContainerView other_info) const;
+
+ private:
+  // Absorb the statement of a proof
+  Transcript StartTranscript(const std::vector<EcPoint>& commitments,
+                             ByteContainerView other_info) const;
+  void AbsorbScalar(const MPInt& s, Transcript* transcript) const;
+  // Absorb label and map the digest to a scalar
+  MPInt Challenge(std::string_view label, Transcript* transcript) const;
+
+  const std::unique_ptr<EcGroup>& group_ref_;
+  const EcPoint g_;
+  const EcPoint h_;
+  const size_t bits_;
+  const size_t max_aggregation_;
+  const MPInt& order_;
+  const size_t scalar_bytes_;
+  // bits_ * max_aggregation_ vector generators
+  std::vector<EcPoint> gens_g_;
+  std::vector<EcPoint> gens_h_;
+  // transcript state after absorbing the parameters
+  Transcript transcript_prefix_;
+};
+
+}  // namespace yacl::crypto
@@ -0,0 +1,149 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/range_proof.h"
+
+#include <functional>
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/primitives/zkp/test_util.h"
+
+namespace yacl::crypto::test {
+
+class RangeProofTest : public ZkpTest {
+ protected:
+  void SetUp() override {
+    ZkpTest::SetUp();
+    h_ = RandomPoints(1)[0];
+  }
+
+  std::vector<EcPoint> Commit(const RangeProtocol& protocol,
+                              const std::vector<MPInt>& values,
+                              const std::vector<MPInt>& blindings) const {
+    std::vector<EcPoint> ret;
+    for (size_t i = 0; i < values.size(); i++) {
+      ret.emplace_back(protocol.Commit(values[i], blindings[i]));
+    }
+    return ret;
+  }
+
+  EcPoint h_;
+};
+
+TEST_F(RangeProofTest, Works) {
+  RangeProtocol protocol(curve_, curve_->GetGenerator(), h_, 32, 4);
+  for (size_t m : {1, 2, 4}) {
+    std::vector<MPInt> values(m);
+    for (auto& v : values) {
+      MPInt::RandomExactBits(32, &v);
+    }
+    values[0] = m == 1 ? 0_mp : (1_mp << 32) - 1_mp;
+    auto blindings = RandomScalars(m);
+    auto commitments = Commit(protocol, values, blindings);
+
+    auto proof = protocol.Prove(values, blindings, "info");
+    EXPECT_EQ(proof.L.size(), 5 + m / 2);
+    EXPECT_TRUE(protocol.Verify(commitments, proof, "info"));
+    EXPECT_FALSE(protocol.Verify(commitments, proof, "other"));
+
+    auto forged = commitments;
+    forged.back() = curve_->Add(forged.back(), curve_->GetGenerator());
+    EXPECT_FALSE(protocol.Verify(forged, proof, "info"));
+    auto forged_proof = proof;
+    forged_proof.t_hat = forged_proof.t_hat.AddMod(1_mp, n_);
+    EXPECT_FALSE(protocol.Verify(commitments, forged_proof, "info"));
+    forged_proof = proof;
+    forged_proof.a = forged_proof.a.AddMod(1_mp, n_);
+    EXPECT_FALSE(protocol.Verify(commitments, forged_proof, "info"));
+    forged_proof = proof;
+    forged_proof.L.pop_back();
+    EXPECT_FALSE(protocol.Verify(commitments, forged_proof, "info"));
+  }
+}
+
+TEST_F(RangeProofTest, OutOfRangeFails) {
+  RangeProtocol protocol(curve_, curve_->GetGenerator(), h_, 8, 2);
+  auto blindings = RandomScalars(2);
+  EXPECT_ANY_THROW(protocol.Prove({256_mp, 1_mp}, blindings, "info"));
+  EXPECT_ANY_THROW(protocol.Prove({1_mp, -1_mp}, blindings, "info"));
+  // 3 values are not allowed
+  EXPECT_ANY_THROW(protocol.Prove({1_mp, 1_mp, 1_mp}, RandomScalars(3), ""));
+
+  // proof of the low bits does not verify the commitment of a large value
+  auto commitments = Commit(protocol, {256_mp + 3_mp, 1_mp}, blindings);
+  auto proof = protocol.Prove({3_mp, 1_mp}, blindings, "info");
+  EXPECT_FALSE(protocol.Verify(commitments, proof, "info"));
+  commitments[0] = protocol.Commit(3_mp, blindings[0]);
+  EXPECT_TRUE(protocol.Verify(commitments, proof, "info"));
+}
+
+TEST_F(RangeProofTest, FullRangeWorks) {
+  RangeProtocol protocol(curve_, curve_->GetGenerator(), h_);
+  EXPECT_EQ(protocol.Bits(), 64);
+  MPInt value;
+  MPInt::RandomExactBits(64, &value);
+  auto blindings = RandomScalars(1);
+  auto proof = protocol.Prove({value}, blindings, "");
+  EXPECT_TRUE(
+      protocol.Verify(Commit(protocol, {value}, blindings), proof, ""));
+}
+
+TEST_F(RangeProofTest, TorsionPointsFail) {
+  // ed25519 has cofactor 8
+  std::unique_ptr<EcGroup> curve = EcGroupFactory::Create("ed25519");
+  EcPoint torsion = Ed25519TorsionPoint();
+  ASSERT_FALSE(curve->IsInCurveGroup(torsion));
+
+  RangeProtocol protocol(curve, curve->GetGenerator(),
+                         curve->MulBase(12345_mp), 8, 1);
+  MPInt blinding = test::RandomScalars(curve->GetOrder(), 1)[0];
+  std::vector<EcPoint> commitments = {protocol.Commit(7_mp, blinding)};
+  auto proof = protocol.Prove({7_mp}, {blinding}, "info");
+  ASSERT_TRUE(protocol.Verify(commitments, proof, "info"));
+
+  // forged points change the transcript as well, so these fail with or
+  // without the group check
+  std::vector<std::function<EcPoint*(RangeNIProof*)>> members = {
+      [](RangeNIProof* p) { return &p->A; },
+      [](RangeNIProof* p) { return &p->S; },
+      [](RangeNIProof* p) { return &p->T1; },
+      [](RangeNIProof* p) { return &p->T2; },
+      [](RangeNIProof* p) { return &p->L[0]; },
+      [](RangeNIProof* p) { return &p->R.back(); }};
+  for (const auto& member : members) {
+    auto forged = proof;
+    EcPoint* point = member(&forged);
+    *point = curve->Add(*point, torsion);
+    EXPECT_FALSE(protocol.Verify(commitments, forged, "info"));
+  }
+  EXPECT_FALSE(protocol.Verify({curve->Add(commitments[0], torsion)}, proof,
+                               "info"));
+
+  // honest proofs under an h with a torsion component: the commitment
+  // carries the torsion of an odd blinding. Scalars are reduced mod the
+  // order, so the torsion left in the verifier's MSM depends on random
+  // parities and about half of these proofs pass without the group check
+  RangeProtocol torsion_protocol(curve, curve->GetGenerator(),
+                                 curve->Add(curve->MulBase(12345_mp), torsion),
+                                 8, 1);
+  commitments = {torsion_protocol.Commit(7_mp, 12345_mp)};
+  ASSERT_FALSE(curve->IsInCurveGroup(commitments[0]));
+  for (size_t i = 0; i < 16; i++) {
+    proof = torsion_protocol.Prove({7_mp}, {12345_mp}, "info");
+    EXPECT_FALSE(torsion_protocol.Verify(commitments, proof, "info"));
+  }
+}
+
+}  // namespace yacl::crypto::test
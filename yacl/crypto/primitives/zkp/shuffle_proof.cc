@@ -0,0 +1,416 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/shuffle_proof.h"
+
+#include <utility>
+
+#include "yacl/utils/parallel.h"
+
+namespace yacl::crypto {
+
+namespace {
+
+// Bits of the challenge vector e and of the random weights in verification.
+// Short challenges suffice for the soundness of the permutation argument and
+// halve the multi-scalar multiplications over inputs & permutation commitment.
+constexpr size_t kShortChallengeBits = 128;
+
+// Minimal number of points per thread in multi-scalar multiplications, and
+// of elements per thread in other loops
+constexpr int64_t kMsmGrainSize = 1024;
+constexpr int64_t kGrainSize = 64;
+
+}  // namespace
+
+ShuffleProtocol::ShuffleProtocol(const std::unique_ptr<EcGroup>& group,
+                                 const EcPoint& h1, const EcPoint& pk,
+                                 size_t max_size, HashAlgorithm hash)
+    : group_ref_(group),
+      h1_(h1),
+      pk_(pk),
+      order_(group->GetOrder()),
+      gens_h_(max_size),
+      transcript_prefix_(hash) {
+  YACL_ENFORCE(max_size > 0, "max_size must be positive");
+  h0_ = group_ref_->HashToCurve(HashToCurveStrategy::TryAndRehash_SHA2,
+                                "yacl/ShuffleProtocol/H0");
+  yacl::parallel_for(0, max_size, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      gens_h_[i] = group_ref_->HashToCurve(
+          HashToCurveStrategy::TryAndRehash_SHA2,
+          fmt::format("yacl/ShuffleProtocol/H/{}", i));
+    }
+  });
+
+  transcript_prefix_.Absorb("ShuffleProtocol");
+  transcript_prefix_.AbsorbPoint(*group_ref_, h1_);
+  transcript_prefix_.AbsorbPoint(*group_ref_, pk_);
+}
+
+ElGamalCiphertext ShuffleProtocol::ReEncrypt(
+    const ElGamalCiphertext& ciphertext, const MPInt& r) const {
+  return {group_ref_->Add(ciphertext.c1, group_ref_->Mul(h1_, r)),
+          group_ref_->Add(ciphertext.c2, group_ref_->Mul(pk_, r))};
+}
+
+std::vector<ElGamalCiphertext> ShuffleProtocol::Shuffle(
+    const std::vector<ElGamalCiphertext>& inputs,
+    const std::vector<size_t>& permutation,
+    const std::vector<MPInt>& randomness) const {
+  const size_t n = inputs.size();
+  YACL_ENFORCE(permutation.size() == n && randomness.size() == n,
+               "#inputs={}, #permutation={}, #randomness={}", n,
+               permutation.size(), randomness.size());
+  for (size_t idx : permutation) {
+    YACL_ENFORCE(idx < n, "invalid permutation");
+  }
+  std::vector<ElGamalCiphertext> outputs(n);
+  yacl::parallel_for(0, n, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t j = beg; j < end; j++) {
+      outputs[j] = ReEncrypt(inputs[permutation[j]], randomness[j]);
+    }
+  });
+  return outputs;
+}
+
+// Notation: g is the group generator, E_i the inputs, E'_j the outputs, and
+// (h1, pk) as a pair is written as P. For permutation pi and randomness rho,
+// E'_j = E_pi(j) + rho_j·P. The prover commits to the permutation by
+// u_pi(j) = r_pi(j)·g + h_j, and for the challenge vector e let e'_j = e_pi(j)
+// be the permuted challenges. It then proves knowledge of the openings of
+//   (1) sum u_i - sum h_j = (sum r_i)·g               => rows of M sum to 1
+//   (2) c_hat_n - (prod e_i)·h0 = b·g, where c_hat_0 = h0 and
+//       c_hat_j = r_hat_j·g + e'_j·c_hat_(j-1)        => prod e'_j = prod e_i
+//   (3) sum e_i·u_i = <r, e>·g + sum e'_j·h_j         => e' = M·e
+//   (4) sum e'_j·E'_j - <e', rho>·P = sum e_i·E_i      => outputs are shuffled
+// with first messages t1..t4 & t_hat, and responses k_a..k_d, k_hat & k'.
+ShuffleNIProof ShuffleProtocol::Prove(
+    const std::vector<ElGamalCiphertext>& inputs,
+    const std::vector<ElGamalCiphertext>& outputs,
+    const std::vector<size_t>& permutation,
+    const std::vector<MPInt>& randomness, ByteContainerView other_info) const {
+  const size_t n = inputs.size();
+  YACL_ENFORCE(n > 0 && n <= MaxSize(),
+               "number of ciphertexts must be in [1, {}], got {}", MaxSize(),
+               n);
+  YACL_ENFORCE(outputs.size() == n && permutation.size() == n &&
+                   randomness.size() == n,
+               "#inputs={}, #outputs={}, #permutation={}, #randomness={}", n,
+               outputs.size(), permutation.size(), randomness.size());
+  std::vector<size_t> pos(n, n);
+  for (size_t j = 0; j < n; j++) {
+    YACL_ENFORCE(permutation[j] < n && pos[permutation[j]] == n,
+                 "invalid permutation");
+    pos[permutation[j]] = j;
+  }
+
+  auto random_scalars = [&](size_t num) {
+    std::vector<MPInt> ret(num);
+    for (auto& s : ret) {
+      MPInt::RandomLtN(order_, &s);
+    }
+    return ret;
+  };
+  auto mul = [&](const MPInt& a, const MPInt& b) {
+    return a.MulMod(b, order_);
+  };
+  auto add = [&](const MPInt& a, const MPInt& b) {
+    return a.AddMod(b, order_);
+  };
+  ShuffleNIProof proof;
+
+  // permutation commitment
+  std::vector<MPInt> r = random_scalars(n);
+  proof.u.resize(n);
+  yacl::parallel_for(0, n, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      proof.u[i] = group_ref_->MulBase(r[i]);
+      group_ref_->AddInplace(&proof.u[i], gens_h_[pos[i]]);
+    }
+  });
+
+  Transcript transcript(transcript_prefix_);
+  std::vector<MPInt> e =
+      ChallengeVector(inputs, outputs, proof.u, other_info, &transcript);
+  std::vector<MPInt> e_prime(n);
+  for (size_t j = 0; j < n; j++) {
+    e_prime[j] = e[permutation[j]];
+  }
+
+  // c_hat_j = x_j·g + y_j·h0, where x_j = r_hat_j + e'_j·x_(j-1) and
+  // y_j = e'_j·y_(j-1), so that all of them are computed in parallel
+  std::vector<MPInt> r_hat = random_scalars(n);
+  std::vector<MPInt> x(n);
+  std::vector<MPInt> y(n);
+  for (size_t j = 0; j < n; j++) {
+    x[j] = j == 0 ? r_hat[0] : add(r_hat[j], mul(e_prime[j], x[j - 1]));
+    y[j] = j == 0 ? e_prime[0] % order_ : mul(e_prime[j], y[j - 1]);
+  }
+  proof.c_hat.resize(n);
+  yacl::parallel_for(0, n, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t j = beg; j < end; j++) {
+      proof.c_hat[j] = group_ref_->MulBase(x[j]);
+      group_ref_->AddInplace(&proof.c_hat[j], group_ref_->Mul(h0_, y[j]));
+    }
+  });
+
+  // first messages
+  std::vector<MPInt> omega = random_scalars(4);
+  std::vector<MPInt> omega_hat = random_scalars(n);
+  std::vector<MPInt> omega_prime = random_scalars(n);
+  proof.t1 = group_ref_->MulBase(omega[0]);
+  proof.t2 = group_ref_->MulBase(omega[1]);
+  proof.t3 = group_ref_->MulBase(omega[2]);
+  group_ref_->AddInplace(
+      &proof.t3,
+      ParallelMultiScalarMul(absl::MakeConstSpan(gens_h_).subspan(0, n),
+                             omega_prime));
+  std::vector<EcPoint> points(n + 1);
+  std::vector<MPInt> scalars(omega_prime);
+  scalars.emplace_back(order_ - omega[3]);
+  for (size_t j = 0; j < n; j++) {
+    points[j] = outputs[j].c1;
+  }
+  points[n] = h1_;
+  proof.t4_1 = ParallelMultiScalarMul(points, scalars);
+  for (size_t j = 0; j < n; j++) {
+    points[j] = outputs[j].c2;
+  }
+  points[n] = pk_;
+  proof.t4_2 = ParallelMultiScalarMul(points, scalars);
+  proof.t_hat.resize(n);
+  yacl::parallel_for(0, n, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t j = beg; j < end; j++) {
+      proof.t_hat[j] = group_ref_->MulBase(omega_hat[j]);
+      group_ref_->AddInplace(
+          &proof.t_hat[j],
+          group_ref_->Mul(j == 0 ? h0_ : proof.c_hat[j - 1], omega_prime[j]));
+    }
+  });
+
+  MPInt c = Challenge(proof, &transcript);
+
+  // responses
+  MPInt r_sum = 0_mp;
+  MPInt r_e = 0_mp;
+  MPInt rho_e = 0_mp;
+  for (size_t i = 0; i < n; i++) {
+    r_sum += r[i];
+    r_e += r[i] * e[i];
+    rho_e += randomness[i] * e_prime[i];
+  }
+  proof.k_a = add(omega[0], mul(c, r_sum));
+  proof.k_b = add(omega[1], mul(c, x[n - 1]));
+  proof.k_c = add(omega[2], mul(c, r_e));
+  proof.k_d = add(omega[3], mul(c, rho_e));
+  proof.k_hat.resize(n);
+  proof.k_prime.resize(n);
+  for (size_t j = 0; j < n; j++) {
+    proof.k_hat[j] = add(omega_hat[j], mul(c, r_hat[j]));
+    proof.k_prime[j] = add(omega_prime[j], mul(c, e_prime[j]));
+  }
+  return proof;
+}
+
+bool ShuffleProtocol::Verify(const std::vector<ElGamalCiphertext>& inputs,
+                             const std::vector<ElGamalCiphertext>& outputs,
+                             const ShuffleNIProof& proof,
+                             ByteContainerView other_info) const {
+  const size_t n = inputs.size();
+  if (n == 0 || n > MaxSize() || outputs.size() != n || proof.u.size() != n ||
+      proof.c_hat.size() != n || proof.t_hat.size() != n ||
+      proof.k_hat.size() != n || proof.k_prime.size() != n) {
+    return false;
+  }
+  auto in_range = [&](const MPInt& s) {
+    return !s.IsNegative() && s < order_;
+  };
+  for (const auto* s : {&proof.k_a, &proof.k_b, &proof.k_c, &proof.k_d}) {
+    if (!in_range(*s)) {
+      return false;
+    }
+  }
+  for (size_t j = 0; j < n; j++) {
+    if (!in_range(proof.k_hat[j]) || !in_range(proof.k_prime[j])) {
+      return false;
+    }
+  }
+  // all points come from the prover or the shuffler, check them in one batch
+  // before hashing
+  std::vector<EcPoint> proof_points;
+  proof_points.reserve(7 * n + 5);
+  for (const auto* cts : {&inputs, &outputs}) {
+    for (const auto& ct : *cts) {
+      proof_points.emplace_back(ct.c1);
+      proof_points.emplace_back(ct.c2);
+    }
+  }
+  for (const auto* vec : {&proof.u, &proof.c_hat, &proof.t_hat}) {
+    proof_points.insert(proof_points.end(), vec->begin(), vec->end());
+  }
+  proof_points.insert(proof_points.end(), {proof.t1, proof.t2, proof.t3,
+                                           proof.t4_1, proof.t4_2});
+  if (!group_ref_->IsInCurveGroup(proof_points)) {
+    return false;
+  }
+  auto mul = [&](const MPInt& a, const MPInt& b) {
+    return a.MulMod(b, order_);
+  };
+  auto add = [&](const MPInt& a, const MPInt& b) {
+    return a.AddMod(b, order_);
+  };
+  auto neg = [&](const MPInt& a) { return (order_ - a) % order_; };
+
+  Transcript transcript(transcript_prefix_);
+  std::vector<MPInt> e =
+      ChallengeVector(inputs, outputs, proof.u, other_info, &transcript);
+  MPInt c = Challenge(proof, &transcript);
+
+  // Check the 5 equations of the sigma protocol and the n equations of the
+  // chain by one multi-scalar multiplication, where every equation but (1) is
+  // weighted by a random alpha_* or beta_j:
+  //   (1) c·(sum u_i - sum h_j) + t1 == k_a·g
+  //   (2) c·(c_hat_n - (prod e_i)·h0) + t2 == k_b·g
+  //   (3) c·sum e_i·u_i + t3 == k_c·g + sum k'_j·h_j
+  //   (4) c·sum e_i·E_i + (t4_1, t4_2) == sum k'_j·E'_j - k_d·P
+  //   (c_hat_j) c·c_hat_j + t_hat_j == k_hat_j·g + k'_j·c_hat_(j-1)
+  auto random_weight = [] {
+    MPInt w;
+    MPInt::RandomExactBits(kShortChallengeBits, &w);
+    return w;
+  };
+  MPInt alpha_b = random_weight();
+  MPInt alpha_c = random_weight();
+  MPInt alpha_1 = random_weight();
+  MPInt alpha_2 = random_weight();
+  std::vector<MPInt> beta(n);
+  for (auto& b : beta) {
+    b = random_weight();
+  }
+  MPInt c_alpha_1 = mul(c, alpha_1);
+  MPInt c_alpha_2 = mul(c, alpha_2);
+
+  // layout: u, h, E.c1, E.c2, E'.c1, E'.c2, c_hat, t_hat, then 9 other points
+  std::vector<EcPoint> points(8 * n + 9);
+  std::vector<MPInt> scalars(points.size());
+  yacl::parallel_for(0, n, kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      points[i] = proof.u[i];
+      scalars[i] = mul(c, add(1_mp, mul(alpha_c, e[i])));
+      points[n + i] = gens_h_[i];
+      scalars[n + i] = neg(add(c, mul(alpha_c, proof.k_prime[i])));
+      points[2 * n + i] = inputs[i].c1;
+      scalars[2 * n + i] = mul(c_alpha_1, e[i]);
+      points[3 * n + i] = inputs[i].c2;
+      scalars[3 * n + i] = mul(c_alpha_2, e[i]);
+      points[4 * n + i] = outputs[i].c1;
+      scalars[4 * n + i] = neg(mul(alpha_1, proof.k_prime[i]));
+      points[5 * n + i] = outputs[i].c2;
+      scalars[5 * n + i] = neg(mul(alpha_2, proof.k_prime[i]));
+      points[6 * n + i] = proof.c_hat[i];
+      if (i + 1 < static_cast<int64_t>(n)) {
+        scalars[6 * n + i] = add(mul(beta[i], c),
+                                 neg(mul(beta[i + 1], proof.k_prime[i + 1])));
+      } else {
+        scalars[6 * n + i] = mul(add(beta[i], alpha_b), c);
+      }
+      points[7 * n + i] = proof.t_hat[i];
+      scalars[7 * n + i] = beta[i];
+    }
+  });
+
+  MPInt prod_e = 1_mp;
+  MPInt g_scalar = add(proof.k_a, add(mul(alpha_b, proof.k_b),
+                                      mul(alpha_c, proof.k_c)));
+  for (size_t i = 0; i < n; i++) {
+    prod_e = mul(prod_e, e[i]);
+    g_scalar = add(g_scalar, mul(beta[i], proof.k_hat[i]));
+  }
+  size_t off = 8 * n;
+  auto add_term = [&](const EcPoint& p, MPInt scalar) {
+    points[off] = p;
+    scalars[off] = std::move(scalar);
+    off++;
+  };
+  add_term(h0_, neg(add(mul(alpha_b, mul(c, prod_e)),
+                        mul(beta[0], proof.k_prime[0]))));
+  add_term(group_ref_->GetGenerator(), neg(g_scalar));
+  add_term(proof.t1, 1_mp);
+  add_term(proof.t2, alpha_b);
+  add_term(proof.t3, alpha_c);
+  add_term(proof.t4_1, alpha_1);
+  add_term(proof.t4_2, alpha_2);
+  add_term(h1_, mul(alpha_1, proof.k_d));
+  add_term(pk_, mul(alpha_2, proof.k_d));
+  return group_ref_->IsInfinity(ParallelMultiScalarMul(points, scalars));
+}
+
+std::vector<MPInt> ShuffleProtocol::ChallengeVector(
+    const std::vector<ElGamalCiphertext>& inputs,
+    const std::vector<ElGamalCiphertext>& outputs,
+    const std::vector<EcPoint>& u, ByteContainerView other_info,
+    Transcript* transcript) const {
+  transcript->Absorb(fmt::format("{}", inputs.size()));
+  for (const auto* ciphertexts : {&inputs, &outputs}) {
+    for (const auto& ct : *ciphertexts) {
+      transcript->AbsorbPoint(*group_ref_, ct.c1);
+      transcript->AbsorbPoint(*group_ref_, ct.c2);
+    }
+  }
+  transcript->Absorb(other_info);
+  transcript->AbsorbPoints(*group_ref_, u);
+  transcript->Absorb("e");
+
+  // e_i = the first kShortChallengeBits of H(transcript || i)
+  std::vector<MPInt> e(u.size());
+  const Transcript& seed = *transcript;
+  yacl::parallel_for(0, e.size(), kGrainSize, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      Transcript fork(seed);
+      fork.Absorb(fmt::format("{}", i));
+      auto digest = fork.Digest();
+      YACL_ENFORCE(digest.size() * 8 >= kShortChallengeBits);
+      e[i].FromMagBytes({digest.data(), kShortChallengeBits / 8},
+                        Endian::little);
+    }
+  });
+  return e;
+}
+
+MPInt ShuffleProtocol::Challenge(const ShuffleNIProof& proof,
+                                 Transcript* transcript) const {
+  transcript->AbsorbPoints(*group_ref_, proof.c_hat);
+  transcript->AbsorbPoints(*group_ref_, proof.t_hat);
+  transcript->AbsorbPoints(*group_ref_, {proof.t1, proof.t2, proof.t3,
+                                         proof.t4_1, proof.t4_2});
+  transcript->Absorb("c");
+  return transcript->ChallengeScalar(order_);
+}
+
+EcPoint ShuffleProtocol::ParallelMultiScalarMul(
+    absl::Span<const EcPoint> points, absl::Span<const MPInt> scalars) const {
+  YACL_ENFORCE(points.size() == scalars.size() && !points.empty());
+  return yacl::parallel_reduce<EcPoint>(
+      0, points.size(), kMsmGrainSize,
+      [&](int64_t beg, int64_t end) {
+        return group_ref_->MultiScalarMul(points.subspan(beg, end - beg),
+                                          scalars.subspan(beg, end - beg));
+      },
+      [&](const EcPoint& a, const EcPoint& b) {
+        return group_ref_->Add(a, b);
+      });
+}
+
+}  // namespace yacl::crypto
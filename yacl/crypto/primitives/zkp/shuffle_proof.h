@@ -0,0 +1,119 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+#include "yacl/crypto/primitives/zkp/transcript.h"
+
+// Verifiable shuffle of EC-ElGamal ciphertexts, following Terelius and
+// Wikstrom, "Proofs of Restricted Shuffles" (AFRICACRYPT 2010), in the form
+// used by Verificatum, see https://www.verificatum.org/files/vmnv-3.1.0.pdf
+//
+// The prover commits to the permutation by Pedersen commitments to the columns
+// of the permutation matrix, and proves that the committed matrix is a
+// permutation and that the outputs are the permuted and re-encrypted inputs,
+// by one sigma protocol. For n ciphertexts a proof has 3·n + 5 points and
+// 2·n + 4 scalars, the prover costs about 7·n scalar multiplications and the
+// verifier checks the whole proof by one multi-scalar multiplication of
+// 8·n + 9 points. Both sides split their multi-scalar multiplications over
+// yacl::parallel threads.
+
+namespace yacl::crypto {
+
+// (c1, c2) = (r·h1, m + r·pk), where h1 is the ElGamal base & pk the public key
+struct ElGamalCiphertext {
+  EcPoint c1;
+  EcPoint c2;
+};
+
+struct ShuffleNIProof {
+  std::vector<EcPoint> u;      // commitment to the permutation
+  std::vector<EcPoint> c_hat;  // chain of commitments to prod_j e'_j
+  std::vector<EcPoint> t_hat;  // first messages of the chain
+  EcPoint t1;
+  EcPoint t2;
+  EcPoint t3;
+  EcPoint t4_1;
+  EcPoint t4_2;
+  MPInt k_a;
+  MPInt k_b;
+  MPInt k_c;
+  MPInt k_d;
+  std::vector<MPInt> k_hat;
+  std::vector<MPInt> k_prime;
+};
+
+class ShuffleProtocol {
+ public:
+  // Ciphertexts are encrypted under (h1, pk), and shuffles could have up to
+  // max_size ciphertexts. The commitment generators are derived by hashing to
+  // the curve, so nobody knows their discrete logarithms.
+  ShuffleProtocol(const std::unique_ptr<EcGroup>& group, const EcPoint& h1,
+                  const EcPoint& pk, size_t max_size,
+                  HashAlgorithm hash = HashAlgorithm::SHA256);
+
+  size_t MaxSize() const { return gens_h_.size(); }
+
+  // Returns: (c1 + r·h1, c2 + r·pk)
+  ElGamalCiphertext ReEncrypt(const ElGamalCiphertext& ciphertext,
+                              const MPInt& r) const;
+
+  // outputs[j] = ReEncrypt(inputs[permutation[j]], randomness[j])
+  std::vector<ElGamalCiphertext> Shuffle(
+      const std::vector<ElGamalCiphertext>& inputs,
+      const std::vector<size_t>& permutation,
+      const std::vector<MPInt>& randomness) const;
+
+  // Prove that outputs = Shuffle(inputs, permutation, randomness). The outputs
+  // are taken as given, a proof for other outputs will not verify.
+  ShuffleNIProof Prove(const std::vector<ElGamalCiphertext>& inputs,
+                       const std::vector<ElGamalCiphertext>& outputs,
+                       const std::vector<size_t>& permutation,
+                       const std::vector<MPInt>& randomness,
+                       ByteContainerView other_info) const;
+  bool Verify(const std::vector<ElGamalCiphertext>& inputs,
+              const std::vector<ElGamalCiphertext>& outputs,
+              const ShuffleNIProof& proof, ByteContainerView other_info) const;
+
+ private:
+  // Absorb the statement and the permutation commitment, and derive the
+  // short challenge vector e from them
+  std::vector<MPInt> ChallengeVector(
+      const std::vector<ElGamalCiphertext>& inputs,
+      const std::vector<ElGamalCiphertext>& outputs,
+      const std::vector<EcPoint>& u, ByteContainerView other_info,
+      Transcript* transcript) const;
+  // Absorb the first messages and derive the challenge
+  MPInt Challenge(const ShuffleNIProof& proof, Transcript* transcript) const;
+  // Returns: sum_i points[i]·scalars[i], split over threads
+  EcPoint ParallelMultiScalarMul(absl::Span<const EcPoint> points,
+                                 absl::Span<const MPInt> scalars) const;
+
+  const std::unique_ptr<EcGroup>& group_ref_;
+  const EcPoint h1_;
+  const EcPoint pk_;
+  const MPInt& order_;
+  // Pedersen commitments use the group generator g, h0 for the chain and
+  // gens_h_ for the permutation matrix
+  EcPoint h0_;
+  std::vector<EcPoint> gens_h_;
+  // transcript state after absorbing the parameters
+  Transcript transcript_prefix_;
+};
+
+}  // namespace yacl::crypto
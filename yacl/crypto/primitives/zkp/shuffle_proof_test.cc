@@ -0,0 +1,165 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/shuffle_proof.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/primitives/zkp/test_util.h"
+
+namespace yacl::crypto::test {
+
+class ShuffleProofTest : public ZkpTest {
+ protected:
+  void SetUp() override {
+    ZkpTest::SetUp();
+    MPInt::RandomLtN(n_, &sk_);
+    pk_ = curve_->MulBase(sk_);
+    protocol_ = std::make_unique<ShuffleProtocol>(
+        curve_, curve_->GetGenerator(), pk_, kMaxSize);
+  }
+
+  // Encrypt messages m_i·g
+  std::vector<ElGamalCiphertext> Encrypt(
+      const std::vector<MPInt>& messages) const {
+    std::vector<ElGamalCiphertext> ret;
+    for (const auto& m : messages) {
+      ElGamalCiphertext zero{curve_->MulBase(0_mp), curve_->MulBase(m)};
+      MPInt r;
+      MPInt::RandomLtN(n_, &r);
+      ret.emplace_back(protocol_->ReEncrypt(zero, r));
+    }
+    return ret;
+  }
+
+  EcPoint Decrypt(const ElGamalCiphertext& ct) const {
+    return curve_->Sub(ct.c2, curve_->Mul(ct.c1, sk_));
+  }
+
+  static constexpr size_t kMaxSize = 32;
+  MPInt sk_;
+  EcPoint pk_;
+  std::unique_ptr<ShuffleProtocol> protocol_;
+};
+
+TEST_F(ShuffleProofTest, Works) {
+  std::mt19937_64 rng(0);
+  for (size_t n : {1, 2, 5, 32}) {
+    auto messages = RandomScalars(n);
+    auto inputs = Encrypt(messages);
+    std::vector<size_t> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+    auto randomness = RandomScalars(n);
+    auto outputs = protocol_->Shuffle(inputs, permutation, randomness);
+    for (size_t j = 0; j < n; j++) {
+      auto expected = curve_->MulBase(messages[permutation[j]]);
+      EXPECT_TRUE(curve_->PointEqual(Decrypt(outputs[j]), expected));
+    }
+
+    auto proof =
+        protocol_->Prove(inputs, outputs, permutation, randomness, "info");
+    EXPECT_EQ(proof.u.size(), n);
+    EXPECT_TRUE(protocol_->Verify(inputs, outputs, proof, "info"));
+    EXPECT_FALSE(protocol_->Verify(inputs, outputs, proof, "other"));
+
+    // outputs which are not a shuffle of the inputs
+    auto forged = outputs;
+    forged[0].c2 = curve_->Add(forged[0].c2, curve_->GetGenerator());
+    EXPECT_FALSE(protocol_->Verify(inputs, forged, proof, "info"));
+    if (n > 1) {
+      forged = outputs;
+      std::swap(forged[0], forged[1]);
+      EXPECT_FALSE(protocol_->Verify(inputs, forged, proof, "info"));
+    }
+    auto forged_proof = proof;
+    forged_proof.k_prime.back() = forged_proof.k_prime.back().AddMod(1_mp, n_);
+    EXPECT_FALSE(protocol_->Verify(inputs, outputs, forged_proof, "info"));
+    forged_proof = proof;
+    forged_proof.k_d = forged_proof.k_d.AddMod(1_mp, n_);
+    EXPECT_FALSE(protocol_->Verify(inputs, outputs, forged_proof, "info"));
+    forged_proof = proof;
+    forged_proof.c_hat.pop_back();
+    EXPECT_FALSE(protocol_->Verify(inputs, outputs, forged_proof, "info"));
+  }
+}
+
+TEST_F(ShuffleProofTest, TorsionPointsFail) {
+  // ed25519 has cofactor 8
+  std::unique_ptr<EcGroup> curve = EcGroupFactory::Create("ed25519");
+  EcPoint torsion = Ed25519TorsionPoint();
+  ASSERT_FALSE(curve->IsInCurveGroup(torsion));
+
+  const auto& order = curve->GetOrder();
+  ShuffleProtocol protocol(curve, curve->GetGenerator(),
+                           curve->MulBase(12345_mp), 4);
+  std::vector<ElGamalCiphertext> inputs;
+  auto randomness = test::RandomScalars(order, 3);
+  for (const auto& r : randomness) {
+    inputs.push_back({curve->MulBase(r), curve->MulBase(r + 1_mp)});
+  }
+  std::vector<size_t> permutation = {2, 0, 1};
+  auto outputs = protocol.Shuffle(inputs, permutation, randomness);
+  auto proof = protocol.Prove(inputs, outputs, permutation, randomness, "");
+  ASSERT_TRUE(protocol.Verify(inputs, outputs, proof, ""));
+
+  auto add_torsion = [&](EcPoint* p) { *p = curve->Add(*p, torsion); };
+  auto forged = proof;
+  add_torsion(&forged.u[1]);
+  EXPECT_FALSE(protocol.Verify(inputs, outputs, forged, ""));
+  forged = proof;
+  add_torsion(&forged.t4_2);
+  EXPECT_FALSE(protocol.Verify(inputs, outputs, forged, ""));
+
+  // honest proofs over ciphertexts with a torsion component. Scalars are
+  // reduced mod the order, so the torsion left in the verifier's MSM depends
+  // on random parities and some proofs pass without the group check
+  add_torsion(&inputs[0].c1);
+  outputs = protocol.Shuffle(inputs, permutation, randomness);
+  for (size_t i = 0; i < 16; i++) {
+    proof = protocol.Prove(inputs, outputs, permutation, randomness, "");
+    EXPECT_FALSE(protocol.Verify(inputs, outputs, proof, ""));
+  }
+}
+
+TEST_F(ShuffleProofTest, DuplicatedInputFails) {
+  // outputs re-encrypt inputs {0, 0, 2}, which is not a permutation
+  auto inputs = Encrypt(RandomScalars(3));
+  auto randomness = RandomScalars(3);
+  std::vector<size_t> mapping = {0, 0, 2};
+  auto outputs = protocol_->Shuffle(inputs, mapping, randomness);
+  EXPECT_ANY_THROW(
+      protocol_->Prove(inputs, outputs, mapping, randomness, "info"));
+
+  std::vector<size_t> identity = {0, 1, 2};
+  auto proof = protocol_->Prove(inputs, outputs, identity, randomness, "info");
+  EXPECT_FALSE(protocol_->Verify(inputs, outputs, proof, "info"));
+}
+
+TEST_F(ShuffleProofTest, SizeLimit) {
+  size_t n = kMaxSize + 1;
+  auto inputs = Encrypt(RandomScalars(n));
+  std::vector<size_t> permutation(n);
+  std::iota(permutation.begin(), permutation.end(), 0);
+  auto randomness = RandomScalars(n);
+  auto outputs = protocol_->Shuffle(inputs, permutation, randomness);
+  EXPECT_ANY_THROW(
+      protocol_->Prove(inputs, outputs, permutation, randomness, "info"));
+}
+
+}  // namespace yacl::crypto::test
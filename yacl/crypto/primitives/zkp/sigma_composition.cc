@@ -0,0 +1,190 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_composition.h"
+
+#include <utility>
+
+namespace yacl::crypto {
+
+SigmaComposition::SigmaComposition(std::vector<const SigmaProtocol*> protocols,
+                                   HashAlgorithm hash)
+    : protocols_(std::move(protocols)),
+      group_(protocols_.empty() ? nullptr : protocols_[0]->group_ref_.get()),
+      order_(group_ == nullptr ? 0_mp : group_->GetOrder()),
+      transcript_prefix_(hash) {
+  YACL_ENFORCE(!protocols_.empty(), "nothing to compose");
+  transcript_prefix_.Absorb("SigmaComposition");
+  for (const auto* protocol : protocols_) {
+    YACL_ENFORCE(protocol->group_ref_.get() == group_,
+                 "all protocols must be over the same group");
+    // the prefix of each relation is a digest of its meta & generators
+    auto digest = protocol->transcript_prefix_.Digest();
+    transcript_prefix_.Absorb(digest);
+  }
+}
+
+std::vector<SigmaNIBatchProof> SigmaComposition::ProveAnd(
+    const std::vector<std::vector<MPInt>>& witnesses,
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<std::vector<MPInt>>& rnd_witnesses,
+    ByteContainerView other_info) const {
+  YACL_ENFORCE(witnesses.size() == Size() && statements.size() == Size() &&
+                   rnd_witnesses.size() == Size(),
+               "size mismatch, #relations={}, #witnesses={}, #statements={}, "
+               "#rnd_witnesses={}",
+               Size(), witnesses.size(), statements.size(),
+               rnd_witnesses.size());
+
+  std::vector<SigmaNIBatchProof> proofs(Size());
+  for (size_t i = 0; i < Size(); i++) {
+    proofs[i].type = protocols_[i]->meta_.type;
+    proofs[i].rnd_statement =
+        protocols_[i]->ToRndStatement(statements[i], rnd_witnesses[i]);
+  }
+  MPInt challenge = GetChallenge("AND", statements, proofs, other_info);
+  for (size_t i = 0; i < Size(); i++) {
+    proofs[i].proof =
+        protocols_[i]->ToProof(witnesses[i], rnd_witnesses[i], challenge);
+  }
+  return proofs;
+}
+
+bool SigmaComposition::VerifyAnd(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    ByteContainerView other_info) const {
+  if (statements.size() != Size() || proofs.size() != Size()) {
+    return false;
+  }
+  for (size_t i = 0; i < Size(); i++) {
+    if (!protocols_[i]->IsWellFormed(statements[i], proofs[i]) ||
+        !protocols_[i]->CheckOpenedValues(statements[i], proofs[i].proof)) {
+      return false;
+    }
+  }
+  MPInt challenge = GetChallenge("AND", statements, proofs, other_info);
+  std::vector<MPInt> challenges(Size(), challenge);
+  return VerifyBranches(statements, proofs, challenges);
+}
+
+SigmaOrProof SigmaComposition::ProveOr(
+    size_t known_idx, const std::vector<MPInt>& witness,
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<MPInt>& rnd_witness, ByteContainerView other_info) const {
+  CheckNoOpenOne();
+  YACL_ENFORCE(known_idx < Size() && statements.size() == Size(),
+               "known_idx={}, #relations={}, #statements={}", known_idx,
+               Size(), statements.size());
+
+  SigmaOrProof ret;
+  ret.challenges.resize(Size());
+  ret.proofs.resize(Size());
+  MPInt known_challenge = 0_mp;
+  for (size_t i = 0; i < Size(); i++) {
+    const auto* protocol = protocols_[i];
+    auto& proof = ret.proofs[i];
+    proof.type = protocol->meta_.type;
+    if (i == known_idx) {
+      proof.rnd_statement =
+          protocol->ToRndStatement(statements[i], rnd_witness);
+      continue;
+    }
+    // simulate: pick the challenge & responses first, then solve the first
+    // message from the verification equation
+    MPInt::RandomLtN(order_, &ret.challenges[i]);
+    proof.proof.resize(protocol->meta_.num_witness);
+    for (auto& s : proof.proof) {
+      MPInt::RandomLtN(order_, &s);
+    }
+    proof.rnd_statement = protocol->RecoverRndStatement(
+        statements[i], proof.proof, ret.challenges[i]);
+    known_challenge -= ret.challenges[i];
+  }
+
+  known_challenge += GetChallenge("OR", statements, ret.proofs, other_info);
+  known_challenge %= order_;
+  ret.proofs[known_idx].proof =
+      protocols_[known_idx]->ToProof(witness, rnd_witness, known_challenge);
+  ret.challenges[known_idx] = std::move(known_challenge);
+  return ret;
+}
+
+bool SigmaComposition::VerifyOr(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const SigmaOrProof& proof, ByteContainerView other_info) const {
+  CheckNoOpenOne();
+  if (statements.size() != Size() || proof.proofs.size() != Size() ||
+      proof.challenges.size() != Size()) {
+    return false;
+  }
+  MPInt sum = 0_mp;
+  for (size_t i = 0; i < Size(); i++) {
+    const auto& c = proof.challenges[i];
+    if (c.IsNegative() || c >= order_ ||
+        !protocols_[i]->IsWellFormed(statements[i], proof.proofs[i])) {
+      return false;
+    }
+    sum += c;
+  }
+  MPInt challenge = GetChallenge("OR", statements, proof.proofs, other_info);
+  if (sum % order_ != challenge % order_) {
+    return false;
+  }
+  return VerifyBranches(statements, proof.proofs, proof.challenges);
+}
+
+MPInt SigmaComposition::GetChallenge(
+    std::string_view kind, const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    ByteContainerView other_info) const {
+  Transcript transcript(transcript_prefix_);
+  transcript.Absorb(kind);
+  for (size_t i = 0; i < Size(); i++) {
+    const auto* protocol = protocols_[i];
+    auto statement = absl::MakeConstSpan(statements[i]);
+    auto rnd_statement = absl::MakeConstSpan(proofs[i].rnd_statement);
+    transcript.AbsorbPoints(
+        *group_, statement.subspan(0, protocol->meta_.num_statement));
+    transcript.AbsorbPoints(
+        *group_, rnd_statement.subspan(0, protocol->NumRndStatement()));
+  }
+  transcript.Absorb(other_info);
+  return internal::SigmaChallengeFromTranscript(transcript, order_);
+}
+
+bool SigmaComposition::VerifyBranches(
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<SigmaNIBatchProof>& proofs,
+    absl::Span<const MPInt> challenges) const {
+  std::vector<EcPoint> points;
+  std::vector<MPInt> scalars;
+  for (size_t i = 0; i < Size(); i++) {
+    const auto* protocol = protocols_[i];
+    std::vector<MPInt> gen_coeffs(protocol->meta_.num_generator, 0_mp);
+    protocol->AppendCheckTerms(statements[i], proofs[i], challenges[i],
+                               &points, &scalars, &gen_coeffs);
+    protocol->AppendGeneratorTerms(gen_coeffs, &points, &scalars);
+  }
+  return group_->IsInfinity(group_->MultiScalarMul(points, scalars));
+}
+
+void SigmaComposition::CheckNoOpenOne() const {
+  for (const auto* protocol : protocols_) {
+    YACL_ENFORCE(protocol->meta_.type != SigmaType::PedersenMultOpenOne,
+                 "PedersenMultOpenOne could not be used in OR proofs");
+  }
+}
+
+}  // namespace yacl::crypto
@@ -0,0 +1,90 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
+
+namespace yacl::crypto {
+
+// Proof of an OR composition: branch i is a proof of relation i under
+// challenges[i], and all challenges sum to the Fiat-Shamir challenge mod the
+// group order.
+struct SigmaOrProof {
+  std::vector<MPInt> challenges;
+  std::vector<SigmaNIBatchProof> proofs;
+};
+
+// AND & OR compositions of several SigmaProtocol relations, proven with one
+// Fiat-Shamir challenge which hashes all relations, statements and first
+// messages in a single transcript.
+// Verification folds the equations of all branches, weighted by random
+// exponents, into one multi-scalar multiplication.
+//
+// All protocols must be over the same EcGroup instance. They are referenced
+// rather than copied, so they must outlive the composition.
+class SigmaComposition {
+ public:
+  explicit SigmaComposition(std::vector<const SigmaProtocol*> protocols,
+                            HashAlgorithm hash = HashAlgorithm::SHA256);
+
+  size_t Size() const { return protocols_.size(); }
+
+  // AND: know the witnesses of every relation.
+  // proofs[i] is a batch proof of relation i, all under the same challenge.
+  std::vector<SigmaNIBatchProof> ProveAnd(
+      const std::vector<std::vector<MPInt>>& witnesses,
+      const std::vector<std::vector<EcPoint>>& statements,
+      const std::vector<std::vector<MPInt>>& rnd_witnesses,
+      ByteContainerView other_info) const;
+  bool VerifyAnd(const std::vector<std::vector<EcPoint>>& statements,
+                 const std::vector<SigmaNIBatchProof>& proofs,
+                 ByteContainerView other_info) const;
+
+  // OR (Cramer-Damgard-Schoenmakers): know the witness of relation known_idx.
+  // Other branches are simulated with random challenges & responses, so the
+  // proof does not reveal known_idx.
+  // PedersenMultOpenOne branches could not be simulated and are rejected.
+  SigmaOrProof ProveOr(size_t known_idx, const std::vector<MPInt>& witness,
+                       const std::vector<std::vector<EcPoint>>& statements,
+                       const std::vector<MPInt>& rnd_witness,
+                       ByteContainerView other_info) const;
+  bool VerifyOr(const std::vector<std::vector<EcPoint>>& statements,
+                const SigmaOrProof& proof, ByteContainerView other_info) const;
+
+ private:
+  // Hash(relations, kind, statements, rnd_statements, other_info)
+  MPInt GetChallenge(std::string_view kind,
+                     const std::vector<std::vector<EcPoint>>& statements,
+                     const std::vector<SigmaNIBatchProof>& proofs,
+                     ByteContainerView other_info) const;
+
+  // Check every branch under its own challenge by one multi-scalar
+  // multiplication
+  bool VerifyBranches(const std::vector<std::vector<EcPoint>>& statements,
+                      const std::vector<SigmaNIBatchProof>& proofs,
+                      absl::Span<const MPInt> challenges) const;
+
+  void CheckNoOpenOne() const;
+
+  const std::vector<const SigmaProtocol*> protocols_;
+  const EcGroup* group_;
+  const MPInt order_;
+  // transcript state after absorbing the constant prefix: all relations
+  Transcript transcript_prefix_;
+};
+
+}  // namespace yacl::crypto
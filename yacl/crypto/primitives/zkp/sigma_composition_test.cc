@@ -0,0 +1,123 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_composition.h"
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/primitives/zkp/test_util.h"
+
+namespace yacl::crypto::test {
+
+class SigmaCompositionTest : public ZkpTest {
+ protected:
+  void SetUp() override {
+    ZkpTest::SetUp();
+    generators_ = RandomPoints(3);
+    dlog_ = std::make_unique<SigmaProtocol>(
+        curve_, generators_, SigmaMeta{SigmaType::Dlog, 1, 1, 1});
+    rep_ = std::make_unique<SigmaProtocol>(
+        curve_, generators_, SigmaMeta{SigmaType::Representation, 3, 3, 1});
+    dlog_eq_ = std::make_unique<SigmaProtocol>(
+        curve_, generators_, SigmaMeta{SigmaType::DlogEq, 1, 2, 2});
+  }
+
+  std::vector<EcPoint> generators_;
+  std::unique_ptr<SigmaProtocol> dlog_;
+  std::unique_ptr<SigmaProtocol> rep_;
+  std::unique_ptr<SigmaProtocol> dlog_eq_;
+};
+
+TEST_F(SigmaCompositionTest, AndWorks) {
+  SigmaComposition composition({dlog_.get(), rep_.get(), dlog_eq_.get()});
+  std::vector<std::vector<MPInt>> witnesses = {
+      RandomScalars(1), RandomScalars(3), RandomScalars(1)};
+  std::vector<std::vector<MPInt>> rnd_witnesses = {
+      RandomScalars(1), RandomScalars(3), RandomScalars(1)};
+  std::vector<std::vector<EcPoint>> statements = {
+      dlog_->ToStatement(witnesses[0]), rep_->ToStatement(witnesses[1]),
+      dlog_eq_->ToStatement(witnesses[2])};
+
+  auto proofs =
+      composition.ProveAnd(witnesses, statements, rnd_witnesses, "info");
+  ASSERT_EQ(proofs.size(), 3);
+  EXPECT_TRUE(composition.VerifyAnd(statements, proofs, "info"));
+  EXPECT_FALSE(composition.VerifyAnd(statements, proofs, "other"));
+
+  // branches are bound together
+  auto forged = proofs;
+  forged[1].proof[2] = forged[1].proof[2].AddMod(1_mp, n_);
+  EXPECT_FALSE(composition.VerifyAnd(statements, forged, "info"));
+  auto forged_statements = statements;
+  forged_statements[2][1] = curve_->Add(statements[2][1], generators_[1]);
+  EXPECT_FALSE(composition.VerifyAnd(forged_statements, proofs, "info"));
+  // a branch does not verify on its own
+  EXPECT_FALSE(rep_->VerifyBatch(statements[1], proofs[1], "info"));
+}
+
+TEST_F(SigmaCompositionTest, OrWorks) {
+  SigmaComposition composition({dlog_.get(), rep_.get(), dlog_eq_.get()});
+  std::vector<size_t> num_witness = {1, 3, 1};
+  for (size_t known = 0; known < 3; known++) {
+    // only the statement of the known branch has a witness
+    auto witness = RandomScalars(num_witness[known]);
+    auto rnd_witness = RandomScalars(num_witness[known]);
+    std::vector<std::vector<EcPoint>> statements = {
+        {curve_->MulBase(RandomScalars(1)[0])},
+        {curve_->MulBase(RandomScalars(1)[0])},
+        {curve_->MulBase(RandomScalars(1)[0]),
+         curve_->MulBase(RandomScalars(1)[0])}};
+    const SigmaProtocol* protocols[] = {dlog_.get(), rep_.get(),
+                                        dlog_eq_.get()};
+    statements[known] = protocols[known]->ToStatement(witness);
+
+    auto proof = composition.ProveOr(known, witness, statements, rnd_witness,
+                                     "info");
+    EXPECT_TRUE(composition.VerifyOr(statements, proof, "info"));
+    EXPECT_FALSE(composition.VerifyOr(statements, proof, "other"));
+
+    auto forged = proof;
+    forged.challenges[(known + 1) % 3] += 1_mp;
+    EXPECT_FALSE(composition.VerifyOr(statements, forged, "info"));
+    forged = proof;
+    auto& response = forged.proofs[known].proof[0];
+    response = response.AddMod(1_mp, n_);
+    EXPECT_FALSE(composition.VerifyOr(statements, forged, "info"));
+  }
+
+  // no witness at all
+  std::vector<std::vector<EcPoint>> statements = {
+      {generators_[2]}, {generators_[0]}, {generators_[0], generators_[2]}};
+  auto proof = composition.ProveOr(0, RandomScalars(1), statements,
+                                   RandomScalars(1), "info");
+  EXPECT_FALSE(composition.VerifyOr(statements, proof, "info"));
+}
+
+TEST_F(SigmaCompositionTest, PrecomputeWorks) {
+  SigmaProtocol fast(curve_, generators_, {SigmaType::Dlog, 1, 1, 1});
+  fast.EnablePrecompute();
+  SigmaComposition composition({&fast, rep_.get()});
+  std::vector<std::vector<MPInt>> witnesses = {RandomScalars(1),
+                                               RandomScalars(3)};
+  std::vector<std::vector<EcPoint>> statements = {
+      fast.ToStatement(witnesses[0]), rep_->ToStatement(witnesses[1])};
+  auto proofs = composition.ProveAnd(witnesses, statements, witnesses, "");
+  EXPECT_TRUE(composition.VerifyAnd(statements, proofs, ""));
+  auto or_proof =
+      composition.ProveOr(1, witnesses[1], statements, witnesses[1], "");
+  EXPECT_TRUE(composition.VerifyOr(statements, or_proof, ""));
+  PrecomputedGenerators::ClearCache();
+}
+
+}  // namespace yacl::crypto::test
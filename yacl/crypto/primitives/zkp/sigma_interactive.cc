@@ -0,0 +1,232 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_interactive.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "yacl/utils/parallel.h"
+
+namespace yacl::crypto {
+
+namespace {
+
+constexpr std::string_view kCommitTag = "SIGMA:COMMIT";
+constexpr std::string_view kChallengeTag = "SIGMA:CHALLENGE";
+constexpr std::string_view kResponseTag = "SIGMA:RESPONSE";
+
+size_t ScalarBytes(const MPInt& order) { return (order.BitCount() + 7) / 8; }
+
+// Message layout: u32 little-endian count, followed by count items. Points
+// are u8 length || point in the default format of the group, and scalars are
+// fixed width little-endian numbers.
+void WriteCount(size_t count, uint8_t* buf) {
+  YACL_ENFORCE(count <= std::numeric_limits<uint32_t>::max());
+  for (size_t i = 0; i < sizeof(uint32_t); i++) {
+    buf[i] = static_cast<uint8_t>(count >> (8 * i));
+  }
+}
+
+size_t ReadCount(ByteContainerView buf) {
+  YACL_ENFORCE(buf.size() >= sizeof(uint32_t), "message is truncated");
+  size_t count = 0;
+  for (size_t i = 0; i < sizeof(uint32_t); i++) {
+    count |= static_cast<size_t>(buf[i]) << (8 * i);
+  }
+  return count;
+}
+
+Buffer PackPoints(const EcGroup& group, absl::Span<const EcPoint> points) {
+  std::vector<Buffer> encoded(points.size());
+  size_t size = sizeof(uint32_t);
+  for (size_t i = 0; i < points.size(); i++) {
+    encoded[i] = group.SerializePoint(points[i]);
+    YACL_ENFORCE(encoded[i].size() <= std::numeric_limits<uint8_t>::max());
+    size += 1 + encoded[i].size();
+  }
+
+  Buffer buf(size);
+  auto* p = buf.data<uint8_t>();
+  WriteCount(points.size(), p);
+  p += sizeof(uint32_t);
+  for (const auto& e : encoded) {
+    *p++ = static_cast<uint8_t>(e.size());
+    std::memcpy(p, e.data(), e.size());
+    p += e.size();
+  }
+  return buf;
+}
+
+// Points received from the other party are checked to be in the group
+std::vector<EcPoint> UnpackPoints(const EcGroup& group, ByteContainerView buf,
+                                  size_t expected_count) {
+  size_t count = ReadCount(buf);
+  YACL_ENFORCE(count == expected_count, "expect {} points, got {}",
+               expected_count, count);
+  std::vector<EcPoint> points;
+  points.reserve(count);
+  size_t pos = sizeof(uint32_t);
+  for (size_t i = 0; i < count; i++) {
+    YACL_ENFORCE(pos < buf.size(), "message is truncated");
+    size_t len = buf[pos++];
+    YACL_ENFORCE(pos + len <= buf.size(), "message is truncated");
+    points.emplace_back(group.DeserializePoint(buf.subspan(pos, len)));
+    pos += len;
+  }
+  YACL_ENFORCE(pos == buf.size(), "{} trailing bytes", buf.size() - pos);
+  YACL_ENFORCE(group.IsInCurveGroup(points), "point is not in the group");
+  return points;
+}
+
+Buffer PackScalars(absl::Span<const MPInt> scalars, size_t scalar_bytes) {
+  Buffer buf(sizeof(uint32_t) + scalars.size() * scalar_bytes);
+  auto* p = buf.data<uint8_t>();
+  WriteCount(scalars.size(), p);
+  p += sizeof(uint32_t);
+  for (const auto& s : scalars) {
+    s.ToBytes(p, scalar_bytes, Endian::little);
+    p += scalar_bytes;
+  }
+  return buf;
+}
+
+std::vector<MPInt> UnpackScalars(ByteContainerView buf, size_t expected_count,
+                                 size_t scalar_bytes) {
+  size_t count = ReadCount(buf);
+  YACL_ENFORCE(count == expected_count, "expect {} scalars, got {}",
+               expected_count, count);
+  YACL_ENFORCE(buf.size() == sizeof(uint32_t) + count * scalar_bytes,
+               "expect {} bytes, got {}",
+               sizeof(uint32_t) + count * scalar_bytes, buf.size());
+  std::vector<MPInt> scalars(count);
+  for (size_t i = 0; i < count; i++) {
+    scalars[i].FromMagBytes(
+        buf.subspan(sizeof(uint32_t) + i * scalar_bytes, scalar_bytes),
+        Endian::little);
+  }
+  return scalars;
+}
+
+}  // namespace
+
+SigmaInteractiveProver::SigmaInteractiveProver(
+    const SigmaProtocol& protocol, std::shared_ptr<link::Context> ctx)
+    : protocol_(protocol), ctx_(std::move(ctx)) {}
+
+void SigmaInteractiveProver::Prove(
+    const std::vector<std::vector<MPInt>>& witnesses,
+    const std::vector<std::vector<EcPoint>>& statements,
+    const std::vector<std::vector<MPInt>>& rnd_witnesses) const {
+  const size_t num = witnesses.size();
+  YACL_ENFORCE(statements.size() == num && rnd_witnesses.size() == num,
+               "size mismatch, #witnesses={}, #statements={}, "
+               "#rnd_witnesses={}",
+               num, statements.size(), rnd_witnesses.size());
+  const auto& meta = protocol_.meta_;
+  for (size_t i = 0; i < num; i++) {
+    YACL_ENFORCE(witnesses[i].size() == meta.num_witness &&
+                     statements[i].size() == meta.num_statement &&
+                     rnd_witnesses[i].size() == meta.num_witness,
+                 "sizes of session {} do not match the relation", i);
+  }
+
+  // Round 1: first messages of all sessions
+  const size_t num_rnd = protocol_.NumRndStatement();
+  std::vector<EcPoint> rnd_statements(num * num_rnd);
+  yacl::parallel_for(0, num, 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      auto rnd = protocol_.ToRndStatement(statements[i], rnd_witnesses[i]);
+      std::move(rnd.begin(), rnd.end(), rnd_statements.begin() + i * num_rnd);
+    }
+  });
+  const auto& group = *protocol_.group_ref_;
+  ctx_->SendAsync(ctx_->NextRank(), PackPoints(group, rnd_statements),
+                  kCommitTag);
+
+  // Round 2 & 3: responses under the challenges of the verifier
+  const size_t scalar_bytes = ScalarBytes(protocol_.order_);
+  auto challenges = UnpackScalars(ctx_->Recv(ctx_->NextRank(), kChallengeTag),
+                                  num, scalar_bytes);
+  std::vector<MPInt> responses(num * meta.num_witness);
+  yacl::parallel_for(0, num, 1, [&](int64_t beg, int64_t end) {
+    for (int64_t i = beg; i < end; i++) {
+      YACL_ENFORCE(challenges[i] < protocol_.order_,
+                   "challenge {} is out of range", i);
+      auto proof =
+          protocol_.ToProof(witnesses[i], rnd_witnesses[i], challenges[i]);
+      std::move(proof.begin(), proof.end(),
+                responses.begin() + i * meta.num_witness);
+    }
+  });
+  ctx_->SendAsync(ctx_->NextRank(), PackScalars(responses, scalar_bytes),
+                  kResponseTag);
+}
+
+void SigmaInteractiveProver::Prove(
+    const std::vector<MPInt>& witness, const std::vector<EcPoint>& statement,
+    const std::vector<MPInt>& rnd_witness) const {
+  Prove(std::vector<std::vector<MPInt>>{witness},
+        std::vector<std::vector<EcPoint>>{statement},
+        std::vector<std::vector<MPInt>>{rnd_witness});
+}
+
+SigmaInteractiveVerifier::SigmaInteractiveVerifier(
+    const SigmaProtocol& protocol, std::shared_ptr<link::Context> ctx)
+    : protocol_(protocol), ctx_(std::move(ctx)) {}
+
+bool SigmaInteractiveVerifier::Verify(
+    const std::vector<std::vector<EcPoint>>& statements,
+    std::vector<size_t>* invalid_idx) const {
+  const size_t num = statements.size();
+  const auto& meta = protocol_.meta_;
+  const auto& group = *protocol_.group_ref_;
+  const size_t num_rnd = protocol_.NumRndStatement();
+  const size_t scalar_bytes = ScalarBytes(protocol_.order_);
+
+  auto rnd_statements = UnpackPoints(
+      group, ctx_->Recv(ctx_->NextRank(), kCommitTag), num * num_rnd);
+
+  std::vector<MPInt> challenges(num);
+  for (auto& challenge : challenges) {
+    MPInt::RandomLtN(protocol_.order_, &challenge);
+  }
+  ctx_->SendAsync(ctx_->NextRank(), PackScalars(challenges, scalar_bytes),
+                  kChallengeTag);
+
+  auto responses =
+      UnpackScalars(ctx_->Recv(ctx_->NextRank(), kResponseTag),
+                    num * meta.num_witness, scalar_bytes);
+  std::vector<SigmaNIBatchProof> proofs(num);
+  for (size_t i = 0; i < num; i++) {
+    proofs[i].type = meta.type;
+    proofs[i].rnd_statement.assign(
+        std::make_move_iterator(rnd_statements.begin() + i * num_rnd),
+        std::make_move_iterator(rnd_statements.begin() + (i + 1) * num_rnd));
+    proofs[i].proof.assign(
+        std::make_move_iterator(responses.begin() + i * meta.num_witness),
+        std::make_move_iterator(responses.begin() +
+                                (i + 1) * meta.num_witness));
+  }
+  return protocol_.VerifyWithChallenges(statements, proofs, challenges,
+                                        invalid_idx);
+}
+
+bool SigmaInteractiveVerifier::Verify(
+    const std::vector<EcPoint>& statement) const {
+  return Verify(std::vector<std::vector<EcPoint>>{statement});
+}
+
+}  // namespace yacl::crypto
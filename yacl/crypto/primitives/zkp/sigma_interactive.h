@@ -0,0 +1,79 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
+#include "yacl/link/context.h"
+
+namespace yacl::crypto {
+
+// Interactive sigma protocol over yacl::link::Context, for deployments where
+// the prover and the verifier are both online.
+//
+// The verifier picks random challenges instead of hashing the transcript, so
+// a proof takes 3 messages:
+//   prover -> verifier: first messages (rnd_statement) of all sessions
+//   verifier -> prover: one random challenge per session
+//   prover -> verifier: responses of all sessions
+// Many sessions of one relation are pipelined, i.e. each message carries all
+// of them, so round trips are amortized across sessions. The verifier checks
+// all sessions by one multi-scalar multiplication like VerifyBatchMany().
+//
+// Note: the proof only convinces the verifier taking part in it, and it is
+// zero-knowledge against honest verifiers only. Use the non-interactive
+// proofs of SigmaProtocol if either matters.
+//
+// Both parties must use the same relation & generators, and the prover's
+// protocol & link context must outlive the prover (same for the verifier).
+class SigmaInteractiveProver {
+ public:
+  SigmaInteractiveProver(const SigmaProtocol& protocol,
+                         std::shared_ptr<link::Context> ctx);
+
+  // Prove sessions i = 0, 1, ... of witnesses[i] for statements[i] with
+  // random stuffs rnd_witnesses[i], which must be fresh for every session.
+  void Prove(const std::vector<std::vector<MPInt>>& witnesses,
+             const std::vector<std::vector<EcPoint>>& statements,
+             const std::vector<std::vector<MPInt>>& rnd_witnesses) const;
+  void Prove(const std::vector<MPInt>& witness,
+             const std::vector<EcPoint>& statement,
+             const std::vector<MPInt>& rnd_witness) const;
+
+ private:
+  const SigmaProtocol& protocol_;
+  std::shared_ptr<link::Context> ctx_;
+};
+
+class SigmaInteractiveVerifier {
+ public:
+  SigmaInteractiveVerifier(const SigmaProtocol& protocol,
+                           std::shared_ptr<link::Context> ctx);
+
+  // Verify the sessions of statements, in the same order as the prover.
+  // If verification fails and invalid_idx is not null, indexes of invalid
+  // sessions are stored in it.
+  bool Verify(const std::vector<std::vector<EcPoint>>& statements,
+              std::vector<size_t>* invalid_idx = nullptr) const;
+  bool Verify(const std::vector<EcPoint>& statement) const;
+
+ private:
+  const SigmaProtocol& protocol_;
+  std::shared_ptr<link::Context> ctx_;
+};
+
+}  // namespace yacl::crypto
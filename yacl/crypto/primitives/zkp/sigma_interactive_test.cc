@@ -0,0 +1,111 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_interactive.h"
+
+#include <future>
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/primitives/zkp/test_util.h"
+#include "yacl/link/test_util.h"
+
+namespace yacl::crypto::test {
+
+class SigmaInteractiveTest : public ZkpTest {
+ protected:
+  void SetUp() override {
+    ZkpTest::SetUp();
+    generators_ = RandomPoints(3);
+    contexts_ = link::test::SetupWorld(2);
+  }
+
+  std::vector<EcPoint> generators_;
+  std::vector<std::shared_ptr<link::Context>> contexts_;
+};
+
+TEST_F(SigmaInteractiveTest, Works) {
+  for (auto meta : {SigmaMeta{SigmaType::Dlog, 1, 1, 1},
+                    SigmaMeta{SigmaType::Representation, 3, 3, 1},
+                    SigmaMeta{SigmaType::SeveralDlogEq, 1, 3, 3},
+                    SigmaMeta{SigmaType::PedersenMult, 5, 2, 3},
+                    SigmaMeta{SigmaType::PedersenMultOpenOne, 5, 2, 3}}) {
+    SigmaProtocol protocol(curve_, generators_, meta);
+    const size_t num = 20;
+    std::vector<std::vector<MPInt>> witnesses;
+    std::vector<std::vector<MPInt>> rnd_witnesses;
+    std::vector<std::vector<EcPoint>> statements;
+    for (size_t i = 0; i < num; i++) {
+      witnesses.emplace_back(RandomScalars(meta.num_witness));
+      rnd_witnesses.emplace_back(RandomScalars(meta.num_witness));
+      statements.emplace_back(protocol.ToStatement(witnesses.back()));
+    }
+
+    SigmaInteractiveProver prover(protocol, contexts_[0]);
+    SigmaInteractiveVerifier verifier(protocol, contexts_[1]);
+    auto prove = std::async(
+        [&] { prover.Prove(witnesses, statements, rnd_witnesses); });
+    std::vector<size_t> invalid_idx;
+    EXPECT_TRUE(verifier.Verify(statements, &invalid_idx));
+    prove.get();
+
+    // sessions with wrong witnesses are located
+    witnesses[3][0] = witnesses[3][0].AddMod(1_mp, n_);
+    witnesses[17][0] = witnesses[17][0].AddMod(1_mp, n_);
+    prove = std::async(
+        [&] { prover.Prove(witnesses, statements, rnd_witnesses); });
+    EXPECT_FALSE(verifier.Verify(statements, &invalid_idx));
+    prove.get();
+    EXPECT_EQ(invalid_idx, (std::vector<size_t>{3, 17}));
+  }
+}
+
+TEST_F(SigmaInteractiveTest, SingleSessionWorks) {
+  SigmaProtocol protocol(curve_, generators_, {SigmaType::DlogEq, 1, 2, 2});
+  SigmaInteractiveProver prover(protocol, contexts_[0]);
+  SigmaInteractiveVerifier verifier(protocol, contexts_[1]);
+  auto witness = RandomScalars(1);
+  auto statement = protocol.ToStatement(witness);
+
+  auto prove = std::async(
+      [&] { prover.Prove(witness, statement, RandomScalars(1)); });
+  EXPECT_TRUE(verifier.Verify(statement));
+  prove.get();
+
+  // statement of another witness
+  auto other = protocol.ToStatement(RandomScalars(1));
+  prove = std::async([&] { prover.Prove(witness, other, RandomScalars(1)); });
+  EXPECT_FALSE(verifier.Verify(other));
+  prove.get();
+}
+
+TEST_F(SigmaInteractiveTest, SessionCountMismatchThrows) {
+  SigmaProtocol protocol(curve_, generators_, {SigmaType::Dlog, 1, 1, 1});
+  SigmaInteractiveProver prover(protocol, contexts_[0]);
+  SigmaInteractiveVerifier verifier(protocol, contexts_[1]);
+  auto witness = RandomScalars(1);
+  auto statement = protocol.ToStatement(witness);
+
+  // the prover sends the first message of one session, but the verifier
+  // expects two
+  auto prove = std::async([&] {
+    EXPECT_ANY_THROW(prover.Prove(witness, statement, RandomScalars(1)));
+  });
+  EXPECT_ANY_THROW(verifier.Verify({statement, statement}));
+  // unblock the prover, which rejects a challenge vector of a wrong size
+  contexts_[1]->SendAsync(0, Buffer(4 + 32 * 2), "SIGMA:CHALLENGE");
+  prove.get();
+}
+
+}  // namespace yacl::crypto::test
@@ -0,0 +1,339 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_proof_view.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace yacl::crypto {
+
+namespace {
+
+constexpr uint8_t kFormatVersion = 1;
+constexpr uint8_t kBatchProofKind = 0;
+constexpr uint8_t kShortProofKind = 1;
+constexpr uint8_t kAggregatedProofKind = 2;
+// version, kind, type, scalar width and number of scalars
+constexpr size_t kHeaderBytes = 8;
+
+size_t ScalarBytes(const MPInt& order) { return (order.BitCount() + 7) / 8; }
+
+// Appends to a buffer, growing it geometrically. Buffer::resize() never
+// shrinks the allocation, so the final size is fixed up by Finish().
+class Writer {
+ public:
+  Writer(Buffer* buf, size_t size_hint) : buf_(buf) {
+    if (buf_->size() < static_cast<int64_t>(size_hint)) {
+      buf_->resize(size_hint);
+    }
+  }
+
+  void U8(uint8_t v) { Reserve(1)[0] = v; }
+
+  void U32(uint32_t v) {
+    auto* p = Reserve(4);
+    for (size_t i = 0; i < 4; i++) {
+      p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+  }
+
+  void Bytes(ByteContainerView bytes) {
+    if (!bytes.empty()) {
+      std::memcpy(Reserve(bytes.size()), bytes.data(), bytes.size());
+    }
+  }
+
+  void Scalar(const MPInt& s, size_t width) {
+    YACL_ENFORCE(!s.IsNegative() && s.BitCount() <= width * 8,
+                 "scalar of {} bits does not fit in {} bytes", s.BitCount(),
+                 width);
+    s.ToBytes(Reserve(width), width, Endian::little);
+  }
+
+  // u8 len || bytes
+  void ShortBytes(ByteContainerView bytes) {
+    YACL_ENFORCE(bytes.size() <= UINT8_MAX, "too long, size={}", bytes.size());
+    U8(bytes.size());
+    Bytes(bytes);
+  }
+
+  void Finish() { buf_->resize(pos_); }
+
+ private:
+  uint8_t* Reserve(size_t n) {
+    if (pos_ + n > static_cast<size_t>(buf_->size())) {
+      buf_->resize(std::max<int64_t>(buf_->size() * 2, pos_ + n));
+    }
+    auto* p = buf_->data<uint8_t>() + pos_;
+    pos_ += n;
+    return p;
+  }
+
+  Buffer* buf_;
+  size_t pos_ = 0;
+};
+
+class Reader {
+ public:
+  explicit Reader(ByteContainerView buf) : buf_(buf) {}
+
+  uint8_t U8() { return Take(1)[0]; }
+
+  uint32_t U32() {
+    auto p = Take(4);
+    uint32_t v = 0;
+    for (size_t i = 0; i < 4; i++) {
+      v |= static_cast<uint32_t>(p[i]) << (8 * i);
+    }
+    return v;
+  }
+
+  ByteContainerView Take(size_t n) {
+    YACL_ENFORCE(n <= buf_.size() - pos_,
+                 "truncated proof, need {} bytes at offset {}, size={}", n,
+                 pos_, buf_.size());
+    ByteContainerView ret = buf_.subspan(pos_, n);
+    pos_ += n;
+    return ret;
+  }
+
+  size_t Offset() const { return pos_; }
+
+  void ExpectEnd() const {
+    YACL_ENFORCE(pos_ == buf_.size(), "{} trailing bytes after proof",
+                 buf_.size() - pos_);
+  }
+
+ private:
+  ByteContainerView buf_;
+  size_t pos_ = 0;
+};
+
+void WriteHeader(const EcGroup& group, uint8_t kind, SigmaType type,
+                 const std::vector<MPInt>& proof, Writer* writer) {
+  size_t scalar_bytes = ScalarBytes(group.GetOrder());
+  YACL_ENFORCE(scalar_bytes <= UINT8_MAX && proof.size() <= UINT32_MAX);
+  writer->U8(kFormatVersion);
+  writer->U8(kind);
+  writer->U8(static_cast<uint8_t>(type));
+  writer->U8(scalar_bytes);
+  writer->U32(proof.size());
+  for (size_t i = 0; i < proof.size(); i++) {
+    // views reject scalars out of [0, order), so never write one
+    YACL_ENFORCE(proof[i] < group.GetOrder(),
+                 "scalar {} is not less than the group order", i);
+    writer->Scalar(proof[i], scalar_bytes);
+  }
+}
+
+// Short & aggregated proofs: header || challenge
+void WriteWithChallenge(const EcGroup& group, uint8_t kind, SigmaType type,
+                        const std::vector<MPInt>& proof,
+                        const MPInt& challenge, Buffer* buf) {
+  size_t scalar_bytes = ScalarBytes(group.GetOrder());
+  YACL_ENFORCE(challenge < group.GetOrder(),
+               "challenge is not less than the group order");
+  Writer writer(buf, kHeaderBytes + (proof.size() + 1) * scalar_bytes);
+  WriteHeader(group, kind, type, proof, &writer);
+  writer.Scalar(challenge, scalar_bytes);
+  writer.Finish();
+}
+
+MPInt ParseChallenge(ByteContainerView challenge_bytes, const MPInt& order) {
+  MPInt challenge;
+  challenge.FromMagBytes(challenge_bytes, Endian::little);
+  YACL_ENFORCE(challenge < order,
+               "challenge is not less than the group order");
+  return challenge;
+}
+
+}  // namespace
+
+void SigmaNIBatchProof::Serialize(const EcGroup& group, Buffer* buf) const {
+  // compressed points are about as long as scalars
+  size_t scalar_bytes = ScalarBytes(group.GetOrder());
+  Writer writer(buf, kHeaderBytes + proof.size() * scalar_bytes + 4 +
+                         rnd_statement.size() * (scalar_bytes + 2));
+  WriteHeader(group, kBatchProofKind, type, proof, &writer);
+  YACL_ENFORCE(rnd_statement.size() <= UINT32_MAX);
+  writer.U32(rnd_statement.size());
+  Buffer point_buf;
+  for (const auto& point : rnd_statement) {
+    group.SerializePoint(point, &point_buf);
+    writer.ShortBytes(ByteContainerView(point_buf));
+  }
+  writer.Finish();
+}
+
+Buffer SigmaNIBatchProof::Serialize(const EcGroup& group) const {
+  Buffer buf;
+  Serialize(group, &buf);
+  return buf;
+}
+
+void SigmaNIShortProof::Serialize(const EcGroup& group, Buffer* buf) const {
+  WriteWithChallenge(group, kShortProofKind, type, proof, challenge, buf);
+}
+
+Buffer SigmaNIShortProof::Serialize(const EcGroup& group) const {
+  Buffer buf;
+  Serialize(group, &buf);
+  return buf;
+}
+
+void SigmaNIAggregatedProof::Serialize(const EcGroup& group,
+                                       Buffer* buf) const {
+  WriteWithChallenge(group, kAggregatedProofKind, type, proof, challenge, buf);
+}
+
+Buffer SigmaNIAggregatedProof::Serialize(const EcGroup& group) const {
+  Buffer buf;
+  Serialize(group, &buf);
+  return buf;
+}
+
+namespace internal {
+
+SigmaProofViewBase::SigmaProofViewBase(const EcGroup& group,
+                                       ByteContainerView buf, uint8_t kind)
+    : group_(group), buf_(buf), order_(group.GetOrder()) {
+  Reader reader(buf_);
+  auto version = reader.U8();
+  YACL_ENFORCE(version == kFormatVersion, "unsupported proof version {}",
+               version);
+  auto real_kind = reader.U8();
+  YACL_ENFORCE(real_kind == kind, "wrong kind of proof, expect {}, got {}",
+               kind, real_kind);
+  auto type = reader.U8();
+  YACL_ENFORCE(type <= static_cast<uint8_t>(SigmaType::ElGamalReEnc),
+               "unknown sigma type {}", type);
+  type_ = static_cast<SigmaType>(type);
+  scalar_bytes_ = reader.U8();
+  YACL_ENFORCE(scalar_bytes_ == ScalarBytes(order_),
+               "scalar width {} does not match the group", scalar_bytes_);
+  num_scalars_ = reader.U32();
+  reader.Take(num_scalars_ * scalar_bytes_);
+  tail_offset_ = reader.Offset();
+}
+
+MPInt SigmaProofViewBase::Scalar(size_t idx) const {
+  YACL_ENFORCE(idx < num_scalars_, "index {} out of range {}", idx,
+               num_scalars_);
+  MPInt s;
+  s.FromMagBytes(buf_.subspan(kHeaderBytes + idx * scalar_bytes_,
+                              scalar_bytes_),
+                 Endian::little);
+  YACL_ENFORCE(s < order_, "scalar {} is not less than the group order", idx);
+  return s;
+}
+
+}  // namespace internal
+
+SigmaNIBatchProofView::SigmaNIBatchProofView(const EcGroup& group,
+                                             ByteContainerView buf)
+    : SigmaProofViewBase(group, buf, kBatchProofKind) {
+  Reader reader(buf_.subspan(tail_offset_));
+  size_t num_points = reader.U32();
+  // every point takes at least one byte, do not trust num_points for reserve
+  point_offsets_.reserve(std::min(num_points, buf_.size()));
+  for (size_t i = 0; i < num_points; i++) {
+    point_offsets_.emplace_back(tail_offset_ + reader.Offset());
+    reader.Take(reader.U8());
+  }
+  reader.ExpectEnd();
+}
+
+ByteContainerView SigmaNIBatchProofView::PointBytes(size_t idx) const {
+  YACL_ENFORCE(idx < point_offsets_.size(), "index {} out of range {}", idx,
+               point_offsets_.size());
+  size_t offset = point_offsets_[idx];
+  return buf_.subspan(offset + 1, buf_[offset]);
+}
+
+EcPoint SigmaNIBatchProofView::Point(size_t idx) const {
+  auto point = group_.DeserializePoint(PointBytes(idx));
+  YACL_ENFORCE(group_.IsInCurveGroup(point), "point {} is not in the group",
+               idx);
+  return point;
+}
+
+std::vector<EcPoint> SigmaNIBatchProofView::Points() const {
+  std::vector<EcPoint> points;
+  points.reserve(NumPoints());
+  for (size_t i = 0; i < NumPoints(); i++) {
+    points.emplace_back(group_.DeserializePoint(PointBytes(i)));
+  }
+  YACL_ENFORCE(group_.IsInCurveGroup(points), "point is not in the group");
+  return points;
+}
+
+SigmaNIBatchProof SigmaNIBatchProofView::ToProof() const {
+  SigmaNIBatchProof proof;
+  proof.type = type_;
+  proof.proof.reserve(num_scalars_);
+  for (size_t i = 0; i < num_scalars_; i++) {
+    proof.proof.emplace_back(Scalar(i));
+  }
+  proof.rnd_statement = Points();
+  return proof;
+}
+
+SigmaNIShortProofView::SigmaNIShortProofView(const EcGroup& group,
+                                             ByteContainerView buf)
+    : SigmaProofViewBase(group, buf, kShortProofKind) {
+  Reader reader(buf_.subspan(tail_offset_));
+  challenge_ = reader.Take(scalar_bytes_);
+  reader.ExpectEnd();
+}
+
+MPInt SigmaNIShortProofView::Challenge() const {
+  return ParseChallenge(challenge_, order_);
+}
+
+SigmaNIShortProof SigmaNIShortProofView::ToProof() const {
+  SigmaNIShortProof proof;
+  proof.type = type_;
+  proof.proof.reserve(num_scalars_);
+  for (size_t i = 0; i < num_scalars_; i++) {
+    proof.proof.emplace_back(Scalar(i));
+  }
+  proof.challenge = Challenge();
+  return proof;
+}
+
+SigmaNIAggregatedProofView::SigmaNIAggregatedProofView(const EcGroup& group,
+                                                       ByteContainerView buf)
+    : SigmaProofViewBase(group, buf, kAggregatedProofKind) {
+  Reader reader(buf_.subspan(tail_offset_));
+  challenge_ = reader.Take(scalar_bytes_);
+  reader.ExpectEnd();
+}
+
+MPInt SigmaNIAggregatedProofView::Challenge() const {
+  return ParseChallenge(challenge_, order_);
+}
+
+SigmaNIAggregatedProof SigmaNIAggregatedProofView::ToProof() const {
+  SigmaNIAggregatedProof proof;
+  proof.type = type_;
+  proof.proof.reserve(num_scalars_);
+  for (size_t i = 0; i < num_scalars_; i++) {
+    proof.proof.emplace_back(Scalar(i));
+  }
+  proof.challenge = Challenge();
+  return proof;
+}
+
+}  // namespace yacl::crypto
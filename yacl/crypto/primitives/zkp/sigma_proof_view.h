@@ -0,0 +1,120 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "yacl/base/byte_container_view.h"
+#include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
+
+// Binary wire format of SigmaNIBatchProof, SigmaNIShortProof and
+// SigmaNIAggregatedProof, all integers are little endian:
+//
+//   u8  version, currently 1
+//   u8  kind, 0 for batch, 1 for short and 2 for aggregated proofs
+//   u8  sigma type
+//   u8  w, byte length of the group order
+//   u32 n, number of scalars
+//   n * w bytes: scalars of proof, fixed width and less than the order
+// then for batch proofs:
+//   u32 m, number of points
+//   m * (u8 len || len bytes): points of rnd_statement, in the default
+//                              (compressed) encoding of the group
+// or for short & aggregated proofs:
+//   w bytes: challenge, fixed width and less than the order
+//
+// A proof over a 256-bit curve costs 8 + 32 * n + 4 + 34 * m bytes.
+
+namespace yacl::crypto {
+
+namespace internal {
+
+// Parsing of the parts shared by all kinds of proofs
+class SigmaProofViewBase {
+ public:
+  SigmaType Type() const { return type_; }
+  size_t NumScalars() const { return num_scalars_; }
+  // Decode proof[idx], throws if it is not less than the group order
+  MPInt Scalar(size_t idx) const;
+
+ protected:
+  SigmaProofViewBase(const EcGroup& group, ByteContainerView buf,
+                     uint8_t kind);
+
+  const EcGroup& group_;
+  ByteContainerView buf_;
+  const MPInt& order_;
+  SigmaType type_;
+  size_t scalar_bytes_;
+  size_t num_scalars_;
+  // offset of the kind-specific tail
+  size_t tail_offset_;
+};
+
+}  // namespace internal
+
+// Read-only view of a serialized SigmaNIBatchProof.
+// The layout is checked on construction, but scalars and points are only
+// decoded (and points validated) when accessed, so rejecting a proof with
+// the wrong type or size costs nothing.
+// Both group and buf must outlive the view.
+class SigmaNIBatchProofView : public internal::SigmaProofViewBase {
+ public:
+  SigmaNIBatchProofView(const EcGroup& group, ByteContainerView buf);
+
+  size_t NumPoints() const { return point_offsets_.size(); }
+  // Raw encoding of rnd_statement[idx], pointing into buf
+  ByteContainerView PointBytes(size_t idx) const;
+  // Decode rnd_statement[idx], throws if it is not in the group
+  EcPoint Point(size_t idx) const;
+  // Decode all of rnd_statement and validate them by one batched
+  // EcGroup::IsInCurveGroup, throws if any is not in the group
+  std::vector<EcPoint> Points() const;
+
+  // Decode & validate everything
+  SigmaNIBatchProof ToProof() const;
+
+ private:
+  std::vector<size_t> point_offsets_;
+};
+
+// Read-only view of a serialized SigmaNIShortProof, see SigmaNIBatchProofView
+class SigmaNIShortProofView : public internal::SigmaProofViewBase {
+ public:
+  SigmaNIShortProofView(const EcGroup& group, ByteContainerView buf);
+
+  MPInt Challenge() const;
+
+  SigmaNIShortProof ToProof() const;
+
+ private:
+  ByteContainerView challenge_;
+};
+
+// Read-only view of a serialized SigmaNIAggregatedProof, see
+// SigmaNIBatchProofView
+class SigmaNIAggregatedProofView : public internal::SigmaProofViewBase {
+ public:
+  SigmaNIAggregatedProofView(const EcGroup& group, ByteContainerView buf);
+
+  MPInt Challenge() const;
+
+  SigmaNIAggregatedProof ToProof() const;
+
+ private:
+  ByteContainerView challenge_;
+};
+
+}  // namespace yacl::crypto
@@ -0,0 +1,172 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/sigma_proof_view.h"
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/primitives/zkp/test_util.h"
+
+namespace yacl::crypto::test {
+
+class SigmaProofViewTest : public ZkpTest {
+ protected:
+  void SetUp() override {
+    ZkpTest::SetUp();
+    generators_ = RandomPoints(3);
+    witness_ = RandomScalars(3);
+    rnd_witness_ = RandomScalars(3);
+  }
+
+  std::vector<EcPoint> generators_;
+  std::vector<MPInt> witness_;
+  std::vector<MPInt> rnd_witness_;
+};
+
+TEST_F(SigmaProofViewTest, BatchProofWorks) {
+  SigmaProtocol protocol(curve_, generators_,
+                         {SigmaType::SeveralDlog, 3, 3, 3});
+  auto statement = protocol.ToStatement(witness_);
+  auto proof = protocol.ProveBatch(witness_, statement, rnd_witness_, "info");
+
+  auto buf = proof.Serialize(*curve_);
+  // header + 3 scalars + number of points + 3 compressed points
+  EXPECT_EQ(buf.size(), 8 + 3 * 32 + 4 + 3 * (1 + 33));
+
+  SigmaNIBatchProofView view(*curve_, buf);
+  EXPECT_EQ(view.Type(), SigmaType::SeveralDlog);
+  ASSERT_EQ(view.NumScalars(), 3);
+  ASSERT_EQ(view.NumPoints(), 3);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(view.Scalar(i), proof.proof[i]);
+    EXPECT_TRUE(curve_->PointEqual(view.Point(i), proof.rnd_statement[i]));
+  }
+  EXPECT_TRUE(protocol.VerifyBatch(statement, view.ToProof(), "info"));
+
+  // serialize into an existing buffer
+  Buffer buf2(1000);
+  proof.Serialize(*curve_, &buf2);
+  EXPECT_EQ(buf, buf2);
+}
+
+TEST_F(SigmaProofViewTest, ShortProofWorks) {
+  SigmaProtocol protocol(curve_, generators_,
+                         {SigmaType::Representation, 3, 3, 1});
+  auto statement = protocol.ToStatement(witness_);
+  auto proof = protocol.ProveShort(witness_, statement, rnd_witness_, "info");
+
+  auto buf = proof.Serialize(*curve_);
+  // header + 3 scalars + challenge
+  EXPECT_EQ(buf.size(), 8 + 3 * 32 + 32);
+
+  SigmaNIShortProofView view(*curve_, buf);
+  EXPECT_EQ(view.Type(), SigmaType::Representation);
+  EXPECT_EQ(view.Challenge(), proof.challenge);
+  auto decoded = view.ToProof();
+  EXPECT_EQ(decoded.proof, proof.proof);
+  EXPECT_TRUE(protocol.VerifyShort(statement, decoded, "info"));
+
+  // a short proof is not a batch proof
+  EXPECT_ANY_THROW(SigmaNIBatchProofView(*curve_, buf));
+}
+
+TEST_F(SigmaProofViewTest, AggregatedProofWorks) {
+  SigmaProtocol protocol(curve_, generators_,
+                         {SigmaType::Representation, 3, 3, 1});
+  std::vector<std::vector<MPInt>> witnesses(4, witness_);
+  std::vector<std::vector<MPInt>> rnd_witnesses(4, rnd_witness_);
+  std::vector<std::vector<EcPoint>> statements(4,
+                                               protocol.ToStatement(witness_));
+  auto proof =
+      protocol.ProveAggregated(witnesses, statements, rnd_witnesses, "info");
+
+  auto buf = proof.Serialize(*curve_);
+  // one challenge for 4 instances
+  EXPECT_EQ(buf.size(), 8 + 4 * 3 * 32 + 32);
+
+  SigmaNIAggregatedProofView view(*curve_, buf);
+  EXPECT_EQ(view.Type(), SigmaType::Representation);
+  EXPECT_EQ(view.NumScalars(), 12);
+  EXPECT_EQ(view.Challenge(), proof.challenge);
+  EXPECT_TRUE(protocol.VerifyAggregated(statements, view.ToProof(), "info"));
+
+  // kinds are not interchangeable
+  EXPECT_ANY_THROW(SigmaNIShortProofView(*curve_, buf));
+  auto short_buf =
+      protocol.ProveShort(witness_, statements[0], rnd_witness_, "info")
+          .Serialize(*curve_);
+  EXPECT_ANY_THROW(SigmaNIAggregatedProofView(*curve_, short_buf));
+}
+
+TEST_F(SigmaProofViewTest, MalformedProofThrows) {
+  SigmaProtocol protocol(curve_, generators_, {SigmaType::DlogEq, 1, 2, 2});
+  auto statement = protocol.ToStatement(witness_);
+  auto proof = protocol.ProveBatch(witness_, statement, rnd_witness_, "info");
+  auto buf = proof.Serialize(*curve_);
+  ByteContainerView view(buf);
+
+  // truncated or with trailing bytes
+  EXPECT_ANY_THROW(SigmaNIBatchProofView(*curve_, view.subspan(0, 20)));
+  EXPECT_ANY_THROW(
+      SigmaNIBatchProofView(*curve_, view.subspan(0, view.size() - 1)));
+  auto longer = std::string(buf) + "x";
+  EXPECT_ANY_THROW(SigmaNIBatchProofView(*curve_, longer));
+
+  // a bad point is only detected on access
+  auto bad_point = std::string(buf);
+  // invalid prefix octet of the last compressed point
+  bad_point[bad_point.size() - 33] = 0x05;
+  SigmaNIBatchProofView lazy(*curve_, bad_point);
+  EXPECT_EQ(lazy.Scalar(0), proof.proof[0]);
+  EXPECT_NO_THROW(lazy.Point(0));
+  EXPECT_ANY_THROW(lazy.Point(1));
+  EXPECT_ANY_THROW(lazy.ToProof());
+
+  // scalars must be canonical
+  auto big_scalar = std::string(buf);
+  std::fill_n(big_scalar.begin() + 8, 32, '\xff');
+  EXPECT_ANY_THROW(SigmaNIBatchProofView(*curve_, big_scalar).Scalar(0));
+
+  // negative scalars could not be serialized
+  proof.proof[0] = -1_mp;
+  EXPECT_ANY_THROW(proof.Serialize(*curve_));
+}
+
+TEST_F(SigmaProofViewTest, NonCanonicalScalarsThrow) {
+  SigmaProtocol protocol(curve_, generators_, {SigmaType::DlogEq, 1, 2, 2});
+  auto statement = protocol.ToStatement(witness_);
+  auto proof = protocol.ProveShort(witness_, statement, rnd_witness_, "info");
+  auto buf = std::string(proof.Serialize(*curve_));
+
+  // the challenge has exactly one encoding: a shorter one is truncated and
+  // challenge + order is out of range
+  EXPECT_ANY_THROW(SigmaNIShortProofView(
+      *curve_, ByteContainerView(buf).subspan(0, buf.size() - 1)));
+  auto big = proof;
+  big.challenge += n_;
+  EXPECT_ANY_THROW(big.Serialize(*curve_));
+  // so are the scalars of the proof
+  big = proof;
+  big.proof[0] += n_;
+  EXPECT_ANY_THROW(big.Serialize(*curve_));
+  SigmaNIBatchProof batch = {SigmaType::Dlog, {n_}, {}};
+  EXPECT_ANY_THROW(batch.Serialize(*curve_));
+  n_.ToBytes(reinterpret_cast<unsigned char*>(buf.data()) + buf.size() - 32,
+             32, Endian::little);
+  SigmaNIShortProofView view(*curve_, buf);
+  EXPECT_ANY_THROW(view.Challenge());
+  EXPECT_ANY_THROW(view.ToProof());
+}
+
+}  // namespace yacl::crypto::test
@@ -0,0 +1,274 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#include "yacl/crypto/primitives/zkp/SigmaProtocol.h"
+
+namespace yacl::crypto {
+
+namespace internal {
+
+// Shapes accepted by SigmaProtocol for each relation type
+constexpr bool IsValidSigmaShape(SigmaType type, uint32_t num_witness,
+                                 uint32_t num_generator,
+                                 uint32_t num_statement) {
+  if (num_witness == 0 || num_generator == 0 || num_statement == 0) {
+    return false;
+  }
+  switch (type) {
+    case SigmaType::Dlog:
+    case SigmaType::Pedersen:
+    case SigmaType::Representation:
+      return num_statement == 1 && num_generator == num_witness;
+    case SigmaType::SeveralDlog:
+      return num_generator == num_statement && num_generator == num_witness;
+    case SigmaType::DlogEq:
+    case SigmaType::SeveralDlogEq:
+    case SigmaType::DHTripple:
+      return num_witness == 1 && num_statement == num_generator;
+    default:
+      return false;
+  }
+}
+
+}  // namespace internal
+
+// SigmaProtocol with the relation fixed at compile time.
+//
+// Witnesses, statements and proofs are std::arrays, and the body of every
+// method is specialized for the relation type, so proving & verifying do not
+// allocate vectors, dispatch on the type or check sizes at runtime.
+// Challenges are computed exactly as in SigmaProtocol with the same meta, so
+// proofs could be converted by ToDynamic()/FromDynamic() and verified by
+// either class.
+//
+// See DlogProtocol, PedersenProtocol, DlogEqProtocol for common instances.
+template <SigmaType kType, uint32_t kNumWitness, uint32_t kNumGenerator,
+          uint32_t kNumStatement>
+class SigmaProtocolT {
+  static_assert(internal::IsValidSigmaShape(kType, kNumWitness, kNumGenerator,
+                                            kNumStatement),
+                "unsupported sigma type or shape");
+
+  // f(x) = h_1^{x_1} + ... + h_n^{x_n}
+  static constexpr bool kIsRepresentation =
+      kType == SigmaType::Dlog || kType == SigmaType::Pedersen ||
+      kType == SigmaType::Representation;
+  // f(x) = (h_1^x, h_2^x, ..., h_n^x)
+  static constexpr bool kIsDlogEq = kType == SigmaType::DlogEq ||
+                                    kType == SigmaType::SeveralDlogEq ||
+                                    kType == SigmaType::DHTripple;
+
+ public:
+  static constexpr SigmaMeta kMeta = {kType, kNumWitness, kNumGenerator,
+                                      kNumStatement};
+
+  using Witness = std::array<MPInt, kNumWitness>;
+  using Generators = std::array<EcPoint, kNumGenerator>;
+  using Statement = std::array<EcPoint, kNumStatement>;
+
+  struct BatchProof {
+    Witness proof;
+    Statement rnd_statement;
+  };
+
+  struct ShortProof {
+    Witness proof;
+    MPInt challenge;
+  };
+
+  // Unlike SigmaProtocol, generators are copied.
+  SigmaProtocolT(const std::unique_ptr<EcGroup>& group,
+                 const Generators& generators,
+                 HashAlgorithm hash = HashAlgorithm::SHA256)
+      : group_ref_(group),
+        generators_(generators),
+        order_(group->GetOrder()),
+        transcript_prefix_(internal::CreateSigmaTranscriptPrefix(
+            *group, generators_, kMeta, hash)) {}
+
+  // See SigmaProtocol::EnablePrecompute()
+  void EnablePrecompute(
+      size_t window_bits = PrecomputedGenerators::kDefaultWindowBits) {
+    gen_tables_ = PrecomputedGenerators::GetOrCreate(*group_ref_, generators_,
+                                                     window_bits);
+  }
+
+  Statement ToStatement(const Witness& witness) const {
+    Statement statement;
+    if constexpr (kIsRepresentation && kNumGenerator == 1) {
+      statement[0] = MulGenerator(0, witness[0]);
+    } else if constexpr (kIsRepresentation) {
+      statement[0] = gen_tables_ != nullptr
+                         ? gen_tables_->MultiScalarMul(*group_ref_, witness)
+                         : group_ref_->MultiScalarMul(generators_, witness);
+    } else {
+      for (uint32_t i = 0; i < kNumStatement; i++) {
+        statement[i] = MulGenerator(i, witness[kIsDlogEq ? 0 : i]);
+      }
+    }
+    return statement;
+  }
+
+  BatchProof ProveBatch(const Witness& witness, const Statement& statement,
+                        const Witness& rnd_witness,
+                        ByteContainerView other_info) const {
+    BatchProof ret_proof;
+    ret_proof.rnd_statement = ToStatement(rnd_witness);
+    MPInt challenge =
+        GetChallenge(statement, ret_proof.rnd_statement, other_info);
+    ret_proof.proof = ToProof(witness, rnd_witness, challenge);
+    return ret_proof;
+  }
+
+  bool VerifyBatch(const Statement& statement, const BatchProof& proof,
+                   ByteContainerView other_info) const {
+    if (!group_ref_->IsInCurveGroup(
+            absl::MakeConstSpan(proof.rnd_statement))) {
+      return false;
+    }
+    MPInt challenge = GetChallenge(statement, proof.rnd_statement, other_info);
+    auto rnd_statement = RecoverRndStatement(statement, proof.proof, challenge);
+    bool res = true;
+    for (uint32_t i = 0; i < kNumStatement; i++) {
+      res &= group_ref_->PointEqual(rnd_statement[i], proof.rnd_statement[i]);
+    }
+    return res;
+  }
+
+  ShortProof ProveShort(const Witness& witness, const Statement& statement,
+                        const Witness& rnd_witness,
+                        ByteContainerView other_info) const {
+    ShortProof ret_proof;
+    ret_proof.challenge =
+        GetChallenge(statement, ToStatement(rnd_witness), other_info);
+    ret_proof.proof = ToProof(witness, rnd_witness, ret_proof.challenge);
+    return ret_proof;
+  }
+
+  bool VerifyShort(const Statement& statement, const ShortProof& proof,
+                   ByteContainerView other_info) const {
+    auto rnd_statement =
+        RecoverRndStatement(statement, proof.proof, proof.challenge);
+    return GetChallenge(statement, rnd_statement, other_info) ==
+           proof.challenge;
+  }
+
+  // Conversions from/to proofs of the runtime SigmaProtocol
+  static SigmaNIBatchProof ToDynamic(const BatchProof& proof) {
+    return {kType,
+            {proof.proof.begin(), proof.proof.end()},
+            {proof.rnd_statement.begin(), proof.rnd_statement.end()}};
+  }
+  static SigmaNIShortProof ToDynamic(const ShortProof& proof) {
+    return {kType, {proof.proof.begin(), proof.proof.end()}, proof.challenge};
+  }
+  static BatchProof FromDynamic(const SigmaNIBatchProof& proof) {
+    YACL_ENFORCE(proof.type == kType && proof.proof.size() == kNumWitness &&
+                     proof.rnd_statement.size() == kNumStatement,
+                 "proof does not match the relation");
+    BatchProof ret;
+    std::copy(proof.proof.begin(), proof.proof.end(), ret.proof.begin());
+    std::copy(proof.rnd_statement.begin(), proof.rnd_statement.end(),
+              ret.rnd_statement.begin());
+    return ret;
+  }
+  static ShortProof FromDynamic(const SigmaNIShortProof& proof) {
+    YACL_ENFORCE(proof.type == kType && proof.proof.size() == kNumWitness,
+                 "proof does not match the relation");
+    ShortProof ret;
+    std::copy(proof.proof.begin(), proof.proof.end(), ret.proof.begin());
+    ret.challenge = proof.challenge;
+    return ret;
+  }
+
+ private:
+  MPInt GetChallenge(const Statement& statement,
+                     const Statement& rnd_statement,
+                     ByteContainerView other_info) const {
+    return internal::GetSigmaChallenge(transcript_prefix_, *group_ref_,
+                                       statement, rnd_statement, other_info);
+  }
+
+  Witness ToProof(const Witness& witness, const Witness& rnd_witness,
+                  const MPInt& challenge) const {
+    Witness proof;
+    for (uint32_t i = 0; i < kNumWitness; i++) {
+      proof[i] = (challenge * witness[i] + rnd_witness[i]) % order_;
+    }
+    return proof;
+  }
+
+  // rnd_statement = f(proof) - challenge * statement
+  Statement RecoverRndStatement(const Statement& statement,
+                                const Witness& proof,
+                                const MPInt& challenge) const {
+    Statement rnd_statement;
+    MPInt neg_challenge = -challenge;
+    if constexpr (kIsRepresentation) {
+      if (gen_tables_ != nullptr) {
+        rnd_statement[0] =
+            group_ref_->Add(gen_tables_->MultiScalarMul(*group_ref_, proof),
+                            group_ref_->Mul(statement[0], neg_challenge));
+      } else {
+        std::array<EcPoint, kNumGenerator + 1> points;
+        std::array<MPInt, kNumWitness + 1> scalars;
+        std::copy(generators_.begin(), generators_.end(), points.begin());
+        std::copy(proof.begin(), proof.end(), scalars.begin());
+        points[kNumGenerator] = statement[0];
+        scalars[kNumWitness] = std::move(neg_challenge);
+        rnd_statement[0] = group_ref_->MultiScalarMul(points, scalars);
+      }
+    } else {
+      for (uint32_t i = 0; i < kNumStatement; i++) {
+        rnd_statement[i] = MulGeneratorAndPoint(i, proof[kIsDlogEq ? 0 : i],
+                                                statement[i], neg_challenge);
+      }
+    }
+    return rnd_statement;
+  }
+
+  EcPoint MulGenerator(uint32_t idx, const MPInt& scalar) const {
+    if (gen_tables_ != nullptr) {
+      return gen_tables_->Mul(*group_ref_, idx, scalar);
+    }
+    return group_ref_->Mul(generators_[idx], scalar);
+  }
+
+  EcPoint MulGeneratorAndPoint(uint32_t idx, const MPInt& s1,
+                               const EcPoint& point, const MPInt& s2) const {
+    if (gen_tables_ != nullptr) {
+      return group_ref_->Add(gen_tables_->Mul(*group_ref_, idx, s1),
+                             group_ref_->Mul(point, s2));
+    }
+    return group_ref_->MultiScalarMul({generators_[idx], point}, {s1, s2});
+  }
+
+  const std::unique_ptr<EcGroup>& group_ref_;
+  const Generators generators_;
+  const MPInt& order_;
+  const Transcript transcript_prefix_;
+  std::shared_ptr<const PrecomputedGenerators> gen_tables_;
+};
+
+using DlogProtocol = SigmaProtocolT<SigmaType::Dlog, 1, 1, 1>;
+using PedersenProtocol = SigmaProtocolT<SigmaType::Pedersen, 2, 2, 1>;
+using DlogEqProtocol = SigmaProtocolT<SigmaType::DlogEq, 1, 2, 2>;
+
+}  // namespace yacl::crypto
@@ -0,0 +1,72 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+#include "yacl/crypto/base/ecc/openssl/openssl_group.h"
+
+namespace yacl::crypto::test {
+
+// n random scalars less than order
+inline std::vector<MPInt> RandomScalars(const MPInt& order, size_t n) {
+  std::vector<MPInt> ret(n);
+  for (auto& s : ret) {
+    MPInt::RandomLtN(order, &s);
+  }
+  return ret;
+}
+
+// The point (0, -1) of order 2 on ed25519, outside the prime-order subgroup
+inline EcPoint Ed25519TorsionPoint() {
+  // y = p - 1, little endian
+  Array32 t;
+  t.fill(static_cast<char>(0xff));
+  t[0] = static_cast<char>(0xec);
+  t[31] = 0x7f;
+  return t;
+}
+
+// Common fixture of the zkp tests over the SM2 curve
+class ZkpTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    curve_ = openssl::OpensslGroup::Create(GetCurveMetaByName("sm2"));
+    n_ = curve_->GetOrder();
+  }
+
+  std::vector<MPInt> RandomScalars(size_t n) const {
+    return test::RandomScalars(n_, n);
+  }
+
+  // n random points of the group, e.g. generators with unknown relations
+  std::vector<EcPoint> RandomPoints(size_t n) const {
+    std::vector<EcPoint> ret;
+    ret.reserve(n);
+    for (const auto& s : RandomScalars(n)) {
+      ret.emplace_back(curve_->MulBase(s));
+    }
+    return ret;
+  }
+
+  std::unique_ptr<EcGroup> curve_;
+  MPInt n_;
+};
+
+}  // namespace yacl::crypto::test
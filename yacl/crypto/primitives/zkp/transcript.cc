@@ -0,0 +1,96 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/transcript.h"
+
+#include <algorithm>
+
+namespace yacl::crypto {
+
+namespace {
+
+std::variant<SslHash, Blake3Hash> CreateHasher(HashAlgorithm hash) {
+  if (hash == HashAlgorithm::BLAKE3) {
+    return std::variant<SslHash, Blake3Hash>(std::in_place_type<Blake3Hash>);
+  }
+  return std::variant<SslHash, Blake3Hash>(std::in_place_type<SslHash>, hash);
+}
+
+}  // namespace
+
+Transcript::Transcript(HashAlgorithm hash)
+    : hash_algo_(hash), hasher_(CreateHasher(hash)) {}
+
+void Transcript::Update(ByteContainerView data) {
+  std::visit([&](auto& hasher) { hasher.Update(data); }, hasher_);
+}
+
+Transcript& Transcript::Absorb(ByteContainerView data) {
+  // 8-bytes little-endian length prefix
+  uint8_t len_buf[sizeof(uint64_t)];
+  uint64_t len = data.size();
+  for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+    len_buf[i] = static_cast<uint8_t>(len >> (8 * i));
+  }
+  Update({len_buf, sizeof(len_buf)});
+  Update(data);
+  return *this;
+}
+
+Transcript& Transcript::AbsorbPoint(const EcGroup& group,
+                                    const EcPoint& point) {
+  group.SerializePoint(point, &point_buf_);
+  return Absorb(ByteContainerView(point_buf_));
+}
+
+Transcript& Transcript::AbsorbPoints(const EcGroup& group,
+                                     absl::Span<const EcPoint> points) {
+  for (const auto& point : points) {
+    AbsorbPoint(group, point);
+  }
+  return *this;
+}
+
+std::vector<uint8_t> Transcript::Digest() const {
+  return std::visit([](const auto& hasher) { return hasher.CumulativeHash(); },
+                    hasher_);
+}
+
+std::vector<uint8_t> Transcript::Digest(size_t output_len) const {
+  if (const auto* blake3 = std::get_if<Blake3Hash>(&hasher_)) {
+    return blake3->CumulativeHash(output_len);
+  }
+
+  // Hash(transcript) || Hash(transcript || 1) || Hash(transcript || 2) ...
+  const auto& hasher = std::get<SslHash>(hasher_);
+  std::vector<uint8_t> out = hasher.CumulativeHash();
+  for (uint8_t counter = 1; out.size() < output_len; ++counter) {
+    YACL_ENFORCE(counter != 0, "output_len {} is too long", output_len);
+    SslHash block(hasher);
+    block.Update({&counter, 1});
+    auto digest = block.CumulativeHash();
+    out.insert(out.end(), digest.begin(), digest.end());
+  }
+  out.resize(output_len);
+  return out;
+}
+
+MPInt Transcript::ChallengeScalar(const MPInt& order) const {
+  size_t len = std::max(kWideScalarBytes, (order.BitCount() + 7) / 8 + 16);
+  MPInt ret;
+  ret.FromMagBytes(Digest(len), order, Endian::little);
+  return ret;
+}
+
+}  // namespace yacl::crypto
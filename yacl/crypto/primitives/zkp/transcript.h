@@ -0,0 +1,74 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <variant>
+#include <vector>
+
+#include "yacl/base/buffer.h"
+#include "yacl/base/byte_container_view.h"
+#include "yacl/crypto/base/ecc/ecc_spi.h"
+#include "yacl/crypto/base/hash/blake3.h"
+#include "yacl/crypto/base/hash/ssl_hash.h"
+
+namespace yacl::crypto {
+
+// Incremental Fiat-Shamir transcript (in the spirit of Merlin / STROBE).
+//
+// Messages are absorbed into a streaming hash one by one, each prefixed with
+// its length, so the encoding is unambiguous and no concatenation buffer is
+// needed. Copying a transcript forks the hash state, which allows caching the
+// state after a constant prefix (e.g. the generators of a protocol) and
+// reusing it for every proof.
+//
+// Supported hash: SHA256, SM3, BLAKE2B, BLAKE3 and other SslHash algorithms.
+class Transcript {
+ public:
+  explicit Transcript(HashAlgorithm hash);
+
+  HashAlgorithm GetHashAlgorithm() const { return hash_algo_; }
+
+  // Absorb a length-prefixed message
+  Transcript& Absorb(ByteContainerView data);
+  // Absorb a point (same encoding as EcGroup::SerializePoint). The
+  // serialization buffer is reused, so no allocation is needed per point.
+  Transcript& AbsorbPoint(const EcGroup& group, const EcPoint& point);
+  Transcript& AbsorbPoints(const EcGroup& group,
+                           absl::Span<const EcPoint> points);
+
+  // Get the digest of everything absorbed so far, the transcript is left
+  // unchanged and can keep absorbing.
+  std::vector<uint8_t> Digest() const;
+  // The same as Digest() but with output_len bytes of output, and shorter
+  // outputs are prefixes of longer ones. BLAKE3 is used as an XOF, other hash
+  // are expanded by Hash(transcript || counter).
+  std::vector<uint8_t> Digest(size_t output_len) const;
+
+  // Map the transcript to a scalar in [0, order) by reducing a wide digest of
+  // max(kWideScalarBytes, bytes of order + 16) bytes, so that the bias is
+  // negligible (below 2^-128).
+  MPInt ChallengeScalar(const MPInt& order) const;
+
+  static constexpr size_t kWideScalarBytes = 64;
+
+ private:
+  void Update(ByteContainerView data);
+
+  HashAlgorithm hash_algo_;
+  std::variant<SslHash, Blake3Hash> hasher_;
+  Buffer point_buf_;
+};
+
+}  // namespace yacl::crypto
@@ -0,0 +1,93 @@
+// Copyright 2023 Ant Group Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yacl/crypto/primitives/zkp/transcript.h"
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+namespace yacl::crypto::test {
+
+class TranscriptTest : public ::testing::TestWithParam<HashAlgorithm> {};
+
+TEST_P(TranscriptTest, ForkWorks) {
+  Transcript prefix(GetParam());
+  prefix.Absorb("prefix");
+
+  Transcript fork1(prefix);
+  Transcript fork2(prefix);
+  fork1.Absorb("message");
+  fork2.Absorb("message");
+  EXPECT_EQ(fork1.Digest(), fork2.Digest());
+
+  // digest doesn't change the state
+  auto digest = fork1.Digest();
+  EXPECT_EQ(fork1.Digest(), digest);
+
+  // forks are independent of each other and the prefix
+  fork2.Absorb("more");
+  EXPECT_NE(fork2.Digest(), digest);
+  EXPECT_EQ(fork1.Digest(), digest);
+  EXPECT_EQ(prefix.Absorb("message").Digest(), digest);
+}
+
+TEST_P(TranscriptTest, EncodingIsUnambiguous) {
+  Transcript t1(GetParam());
+  Transcript t2(GetParam());
+  t1.Absorb("ab").Absorb("c");
+  t2.Absorb("a").Absorb("bc");
+  EXPECT_NE(t1.Digest(), t2.Digest());
+}
+
+TEST_P(TranscriptTest, AbsorbPointWorks) {
+  auto ec = EcGroupFactory::Create("sm2");
+  std::vector<EcPoint> points = {ec->MulBase(0_mp), ec->MulBase(123_mp),
+                                 ec->GetGenerator()};
+
+  Transcript t1(GetParam());
+  Transcript t2(GetParam());
+  t1.AbsorbPoints(*ec, points);
+  for (const auto& point : points) {
+    t2.Absorb(ByteContainerView(ec->SerializePoint(point)));
+  }
+  EXPECT_EQ(t1.Digest(), t2.Digest());
+}
+
+TEST_P(TranscriptTest, WideDigestWorks) {
+  Transcript t(GetParam());
+  t.Absorb("message");
+  auto digest = t.Digest();
+  auto wide = t.Digest(Transcript::kWideScalarBytes);
+  ASSERT_EQ(wide.size(), Transcript::kWideScalarBytes);
+  EXPECT_EQ(t.Digest(digest.size()), digest);
+  EXPECT_TRUE(std::equal(digest.begin(), digest.end(), wide.begin()));
+  EXPECT_EQ(t.Digest(100).size(), 100);
+
+  auto ec = EcGroupFactory::Create("sm2");
+  MPInt c = t.ChallengeScalar(ec->GetOrder());
+  EXPECT_FALSE(c.IsNegative());
+  EXPECT_LT(c, ec->GetOrder());
+  MPInt expected;
+  expected.FromMagBytes(wide, ec->GetOrder(), Endian::little);
+  EXPECT_EQ(c, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllHash, TranscriptTest,
+                         ::testing::Values(HashAlgorithm::SHA256,
+                                           HashAlgorithm::SM3,
+                                           HashAlgorithm::BLAKE2B,
+                                           HashAlgorithm::BLAKE3));
+
+}  // namespace yacl::crypto::test